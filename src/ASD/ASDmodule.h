@@ -31,6 +31,16 @@
  *   outputSVX = "hoge.svx"
  *   outputSubdomain = "no"
  * }
+ *
+ * DivisionPolicy = "weighted" の場合，分割数はcommunicationと同じ方法で決め，
+ * 各軸の分割面を計算コストの1次元累積和から不等間隔に決める．
+ * 求めた分割面は負荷の推定と提案のための出力であり，ソルバーの領域分割には反映されない
+ * （CPMlibのVoxelInit()は各軸を等分割するため，分割面を与えるインターフェイスがない）．以下はオプション
+ *
+ *   CostBlock     = 8                  // コスト評価のブロックサイズ（ボクセル）
+ *   CostWeight    = (1.0, 0.2, 2.0)    // セルの相対コスト (fluid, solid, cut)
+ *   outputPartition = "partition.txt"  // 各軸の分割面の出力（提案値）
+ *   CostMap       = "costmap.txt"      // 前回の実行で計測したランクごとの計算時間（ポリゴンによる評価の代わり）
  */
 
 #include "DomainInfo.h"
@@ -63,6 +73,14 @@ class ASD : public DomainInfo {
     md_solid
   };
   
+  /// コスト評価ブロックの状態
+  enum cost_state {
+    cb_unknown = 0,
+    cb_cut,
+    cb_fluid,
+    cb_solid
+  };
+  
 private:
   ///< int G_division[3];     プロセス分割数   GlobalDivision
   ///< int size[3];           全領域ボクセル数 GlobalVoxel
@@ -83,6 +101,12 @@ private:
   int guide;
   int divPolicy;
   
+  bool divWeight;         ///< 計算コストで重み付けした分割
+  int cost_blk;           ///< コスト評価のブロックサイズ（ボクセル）
+  REAL_TYPE cost_w[3];    ///< セルの相対コスト [fluid, solid, cut]
+  string out_part;        ///< 重み付き分割の出力ファイル
+  string cost_map;        ///< 計測コストマップのファイル
+  
   
   long long *d_cut; ///< 距離情報
   int    *d_bid; ///< BC
@@ -100,6 +124,11 @@ public:
     guide = 1;
     divPolicy = -1;
     PG = NULL;
+    divWeight = false;
+    cost_blk  = 8;
+    cost_w[0] = 1.0;
+    cost_w[1] = 0.2;
+    cost_w[2] = 2.0;
     
     for (int i=0; i<3; i++)
     {
@@ -154,6 +183,34 @@ private:
   void fill(bool disp_flag, Geometry* GM);
   
   
+  // ブロックごとの計算コストを評価する
+  void evaluateCost(REAL_TYPE* cost, const int* nb);
+  
+  
+  // 計測コストマップからブロックのコストを作る
+  bool loadCostMap(REAL_TYPE* cost, const int* nb);
+  
+  
+  // 直方体領域の推定コスト
+  double getBoxCost(const REAL_TYPE* cost, const int* nb, const int* lo, const int* hi);
+  
+  
+  // 各軸の分割面を重み付き累積和から決める
+  void decideWeightedPlane(const REAL_TYPE* cost, const int* nb, int* plane[3]);
+  
+  
+  // 分割の推定負荷を集計する
+  void getImbalance(const REAL_TYPE* cost, const int* nb, int* plane[3], double* st);
+  
+  
+  // 計算コストによる重み付き分割
+  void WeightedDivision(bool flag);
+  
+  
+  // 重み付き分割の分割面を出力する
+  bool writePartition(int* plane[3]);
+  
+  
   // サブドメイン内に含まれるポリゴンリストを検索し，フラグを立てる
   void findPolygon(const REAL_TYPE* px,
                    const REAL_TYPE* py,
@@ -23,6 +23,8 @@
  */
 
 #include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include "FB_Define.h"
 
 
@@ -35,8 +37,52 @@ public:
   /**　デストラクタ */
   ~Alloc() {}
   
+private:
+  static int first_touch; ///< ONのとき，カーネルのk方向static分割に合わせて並列に初期化
+  static int huge_page;   ///< ONのとき，大きな配列にTransparent Huge Pageを要求
+  
+  // 整列したメモリ領域を確保する
+  static void* Aligned(const size_t nbyte);
+  
+  // 配列を確保し，ゼロで初期化する
+  template <class T>
+  static T* Array(const int* sz, const int gc, const int dnum, const bool interleave);
+  
 public:
-
+  
+  /**
+   * @brief 配列確保の方針を設定する
+   * @param [in] m_first_touch ファーストタッチ初期化 (ON/OFF)
+   * @param [in] m_huge_page   Transparent Huge Page (ON/OFF)
+   */
+  static void setPolicy(const int m_first_touch, const int m_huge_page)
+  {
+    first_touch = m_first_touch;
+    huge_page   = m_huge_page;
+  }
+  
+  
+  /**
+   * @brief Allocで確保した領域を解放する
+   * @param [in] var 配列ポインタ
+   */
+  static void Free(void* var)
+  {
+    if ( var ) free(var);
+  }
+  
+  
+  /**
+   * @brief 配列のページが配置されたNUMAノードを表示する
+   * @param [in] fp  ファイルポインタ
+   * @param [in] var 配列ポインタ
+   * @param [in] sz  計算内部領域のサイズ
+   * @param [in] gc  ガイドセルサイズ
+   * @param [in] str 表示用文字列
+   */
+  static void printPlacement(FILE* fp, const REAL_TYPE* var, const int* sz, const int gc, const char* str);
+  
+  
   /**
    @brief データ領域をアロケートする
    @retval エラーコード
@@ -60,13 +106,18 @@ public:
   static REAL_TYPE* Real_S4D(const int* sz, const int gc, const int dnum);
   
   static REAL_TYPE* Real_V3D(const int* sz, const int gc);
+  
+  static STORE_TYPE* Store_S3D(const int* sz, const int gc);
+  
+  static STORE_TYPE* Store_S4D(const int* sz, const int gc, const int dnum);
+  
+  static STORE_TYPE* Store_V3D(const int* sz, const int gc);
 
   static unsigned* Uint_S3D(const int* sz, const int gc);
 
-  static REAL_TYPE* Real_T3D(const int* sz, const int gc)
-  {
-    return Real_S4D(sz, gc, 6);
-  }
+  static REAL_TYPE* Real_T3D(const int* sz, const int gc);
+  
+  static STORE_TYPE* Store_T3D(const int* sz, const int gc);
 };
 
 #endif // _FB_ALLOC_H_
@@ -0,0 +1,172 @@
+#ifndef _FB_COMM_PROGRESS_H_
+#define _FB_COMM_PROGRESS_H_
+
+//##################################################################################
+//
+// Flow Base class
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   CommProgress.h
+ * @brief  FlowBase CommProgress class Header
+ * @author aics
+ */
+
+// 使用例
+//     CommProgress CP;
+//     if ( CP.start() ) omp_set_num_threads(n-1);  // 1スレッドを通信進行に割り当てる
+//     ...
+//     MPI_Startall(n, req);
+//     CP.attach(req, n);     // 計算中は進行スレッドがMPI_Testall()を呼ぶ
+//     (計算)
+//     CP.detach(req);        // 以降の完了待ちは呼び出し側で行う
+//     MPI_Waitall(n, req, MPI_STATUSES_IGNORE);
+//     ...
+//     CP.stop();             // MPI_Finalize()の前に呼ぶ
+//
+//   非同期進行を持たないMPI実装でも，計算と通信の重なりを得るためのスレッド
+//   主スレッドと同時にMPIを呼ぶので，MPI_THREAD_MULTIPLEが必要
+
+#include <pthread.h>
+#include <sched.h>
+#include "mpi.h"
+
+
+class CommProgress {
+
+public:
+  enum
+  {
+    max_slot = 16
+  };
+
+private:
+
+  /** 監視するリクエスト列 */
+  typedef struct
+  {
+    MPI_Request* req; ///< リクエスト列の先頭
+    int n;            ///< 要素数
+    bool done;        ///< 全て完了
+  } Slot;
+
+  Slot slot[max_slot];
+  int nslot;              ///< 登録数
+  int nactive;            ///< 未完了の登録数
+
+  pthread_t th;           ///< 進行スレッド
+  pthread_mutex_t mtx;    ///< slotの排他
+  pthread_cond_t cnd;     ///< 登録の通知
+  bool running;           ///< 起動済みフラグ
+  bool quit;              ///< 終了要求
+
+  unsigned long n_test;   ///< MPI_Testall()の呼び出し回数
+
+
+public:
+  /** コンストラクタ */
+  CommProgress() {
+    nslot   = 0;
+    nactive = 0;
+    running = false;
+    quit    = false;
+    n_test  = 0;
+
+    for (int i=0; i<max_slot; i++)
+    {
+      slot[i].req  = NULL;
+      slot[i].n    = 0;
+      slot[i].done = true;
+    }
+
+    pthread_mutex_init(&mtx, NULL);
+    pthread_cond_init(&cnd, NULL);
+  }
+
+  /**　デストラクタ */
+  ~CommProgress() {
+    stop();
+    pthread_cond_destroy(&cnd);
+    pthread_mutex_destroy(&mtx);
+  }
+
+
+public:
+
+  /**
+   * @brief MPIのスレッドサポートが進行スレッドに足りるか
+   */
+  static bool isAvailable()
+  {
+    int provided = MPI_THREAD_SINGLE;
+    if ( MPI_Query_thread(&provided) != MPI_SUCCESS ) return false;
+    return ( provided == MPI_THREAD_MULTIPLE );
+  }
+
+
+  /**
+   * @brief 進行スレッドを起動する
+   * @retval MPI_THREAD_MULTIPLEでない場合，またはスレッド生成に失敗した場合false
+   */
+  bool start();
+
+
+  /**
+   * @brief 進行スレッドを停止する
+   * @note MPI_Finalize()の前に呼ぶこと
+   */
+  void stop();
+
+
+  /** @brief 起動済みか */
+  bool isRunning() const
+  {
+    return running;
+  }
+
+
+  /**
+   * @brief 開始済みのリクエスト列を監視対象にする
+   * @param [in] req リクエスト列
+   * @param [in] n   要素数
+   * @retval 登録数の上限を超えた場合false
+   */
+  bool attach(MPI_Request* req, const int n);
+
+
+  /**
+   * @brief 監視対象から外す
+   * @param [in] req attach()したリクエスト列
+   * @note 戻った後は進行スレッドがreqに触れないので，呼び出し側で完了を待つ
+   */
+  void detach(MPI_Request* req);
+
+
+  /** @brief MPI_Testall()の呼び出し回数 */
+  unsigned long getTestCount() const
+  {
+    return n_test;
+  }
+
+
+private:
+
+  // スレッドの本体
+  static void* entry(void* arg);
+
+  // 監視ループ
+  void loop();
+
+};
+
+#endif // _FB_COMM_PROGRESS_H_
@@ -280,6 +280,7 @@ public:
     int PDE;
     int Precision;
     int Profiling;
+    int CostMap;
     int PrsNeuamnnType;
     int ShapeAprx;
     int Steady;
@@ -300,6 +301,12 @@ public:
     int PM_Test;
     int GeomOutput;
     int GlyphOutput;
+    int GlyphShared; ///< グリフを1ファイルに出力
+    int FirstTouch;  ///< 配列のファーストタッチ初期化
+    int HugePage;    ///< Transparent Huge Page
+    int CommThread;  ///< 通信進行スレッド
+    int PolyLoad;    ///< ポリゴンの並列読み込み
+    int GeomCache;   ///< 形状前処理のキャッシュ
   } Hidden_Parameter;
   
   
@@ -447,6 +454,7 @@ public:
     tg_derived,    ///< 派生変数の出力
     tg_accelra,    ///< 加速時間
     tg_sampled,    ///< サンプリング出力
+    tg_stat_smpl,  ///< 統計値のサンプリング
     tg_END
   };
   
@@ -529,6 +537,7 @@ public:
   
   string RefMedium;      ///< 参照媒質名 -> int RefMat
   string OperatorName;
+  string GeomCacheDir;   ///< 形状前処理キャッシュのディレクトリ
   
   string ver_TP;   ///< TextPerser version no.
   string ver_CPM;  ///< CPMlib
@@ -603,6 +612,7 @@ public:
     Mode.PDE = 0;
     Mode.Precision = 0;
     Mode.Profiling = 0;
+    Mode.CostMap = 0;
     Mode.PrsNeuamnnType = 0;
     Mode.ShapeAprx = 0;
     Mode.Steady = 0;
@@ -629,6 +639,12 @@ public:
     Hide.PM_Test = 0;
     Hide.GeomOutput = OFF;
     Hide.GlyphOutput = OFF;
+    Hide.GlyphShared = ON;
+    Hide.FirstTouch = ON;
+    Hide.HugePage = OFF;
+    Hide.CommThread = OFF;
+    Hide.PolyLoad = OFF;
+    Hide.GeomCache = OFF;
     
     Unit.Param  = 0;
     Unit.Output = 0;
@@ -0,0 +1,179 @@
+#ifndef _FB_CUT_STORE_H_
+#define _FB_CUT_STORE_H_
+
+//##################################################################################
+//
+// Flow Base class
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   CutStore.h
+ * @brief  FlowBase CutStore class Header
+ * @author aics
+ */
+
+// 使用例
+//     CutStore CS;
+//     CS.build(size, guide, d_cut, d_bid);  // 全領域配列から交点セルを抽出
+//     Alloc::Free(d_cut);                   // 全領域配列は解放してよい
+//     long long pos = CS.getCut(i, j, k);
+//     int       bd  = CS.getBid(i, j, k);
+//
+//   交点または境界IDをもつセルだけを線形インデクスの昇順に保持する．
+//   登録のないセルは，交点なし（initBit9()の値）と境界IDゼロを返す．
+//   bidの状態ビット（30, 31）は保持しないので，bcd[]から得ること
+
+#include <stdio.h>
+#include "FB_Define.h"
+
+
+class CutStore {
+
+private:
+  int size[3];     ///< 計算内部領域のサイズ
+  int guide;       ///< ガイドセルサイズ
+  size_t nEntry;   ///< 登録セル数
+  size_t* idx;     ///< 線形インデクス（昇順）
+  long long* cut;  ///< 交点情報
+  int* bid;        ///< 境界ID（下位30bit）
+  long long empty; ///< 交点のないセルの交点情報
+
+
+public:
+  /** コンストラクタ */
+  CutStore() {
+    size[0] = size[1] = size[2] = 0;
+    guide  = 0;
+    nEntry = 0;
+    idx    = NULL;
+    cut    = NULL;
+    bid    = NULL;
+
+    empty = 0;
+    for (int dir=0; dir<6; dir++) initBit9(empty, dir);
+  }
+
+  /**　デストラクタ */
+  ~CutStore() {
+    release();
+  }
+
+
+private:
+
+  // 線形インデクスmの登録位置を返す
+  long long find(const size_t m) const;
+
+
+public:
+
+  // 全領域配列から交点セルを抽出する
+  bool build(const int* sz, const int gc, const long long* d_cut, const int* d_bid);
+
+
+  // 登録を破棄する
+  void release();
+
+
+  /**
+   * @brief 登録セル数
+   */
+  size_t getEntry() const
+  {
+    return nEntry;
+  }
+
+
+  /**
+   * @brief 使用メモリ量 (byte)
+   */
+  double getMemory() const
+  {
+    return (double)nEntry * (double)( sizeof(size_t) + sizeof(long long) + sizeof(int) );
+  }
+
+
+  /**
+   * @brief 線形インデクスの配列
+   */
+  const size_t* getIndex() const
+  {
+    return idx;
+  }
+
+
+  /**
+   * @brief 登録位置nの交点情報
+   * @param [in] n 登録位置
+   */
+  long long getCutAt(const size_t n) const
+  {
+    return cut[n];
+  }
+
+
+  /**
+   * @brief 登録位置nの境界ID
+   * @param [in] n 登録位置
+   */
+  int getBidAt(const size_t n) const
+  {
+    return bid[n];
+  }
+
+
+  /**
+   * @brief 登録位置nのセルインデクス
+   * @param [in]  n 登録位置
+   * @param [out] i,j,k セルインデクス
+   */
+  void getIndexAt(const size_t n, int& i, int& j, int& k) const
+  {
+    size_t nx = (size_t)(size[0] + 2*guide);
+    size_t ny = (size_t)(size[1] + 2*guide);
+    size_t m  = idx[n];
+
+    i = (int)(m % nx) + 1 - guide;
+    j = (int)((m / nx) % ny) + 1 - guide;
+    k = (int)(m / (nx*ny)) + 1 - guide;
+  }
+
+
+  /**
+   * @brief セル(i,j,k)の交点情報
+   * @param [in] i,j,k セルインデクス
+   */
+  long long getCut(const int i, const int j, const int k) const
+  {
+    long long n = find( _F_IDX_S3D(i, j, k, size[0], size[1], size[2], guide) );
+    return ( n < 0 ) ? empty : cut[n];
+  }
+
+
+  /**
+   * @brief セル(i,j,k)の境界ID
+   * @param [in] i,j,k セルインデクス
+   */
+  int getBid(const int i, const int j, const int k) const
+  {
+    long long n = find( _F_IDX_S3D(i, j, k, size[0], size[1], size[2], guide) );
+    return ( n < 0 ) ? 0 : bid[n];
+  }
+
+
+  // 線形インデクス[m_lo, m_hi]に含まれる登録位置の範囲を返す
+  void getRange(const size_t m_lo, const size_t m_hi, size_t& first, size_t& last) const;
+
+};
+
+#endif // _FB_CUT_STORE_H_
@@ -306,6 +306,42 @@ public:
    */
   static void copyV3D (REAL_TYPE* dst, const int* size, const int guide, const REAL_TYPE* src, const REAL_TYPE scale);
   
+  /**
+   * @brief 格納型S3D配列を演算型配列へロード
+   * @param [out]    dst   出力 (REAL_TYPE)
+   * @param [in]     size  配列サイズ
+   * @param [in]     guide ガイドセルサイズ
+   * @param [in]     src   入力 (STORE_TYPE)
+   */
+  static void loadS3D (REAL_TYPE* dst, const int* size, const int guide, const STORE_TYPE* src);
+  
+  /**
+   * @brief 格納型V3D配列を演算型配列へロード
+   * @param [out]    dst   出力 (REAL_TYPE)
+   * @param [in]     size  配列サイズ
+   * @param [in]     guide ガイドセルサイズ
+   * @param [in]     src   入力 (STORE_TYPE)
+   */
+  static void loadV3D (REAL_TYPE* dst, const int* size, const int guide, const STORE_TYPE* src);
+  
+  /**
+   * @brief 演算型S3D配列を格納型配列へストア
+   * @param [out]    dst   出力 (STORE_TYPE)
+   * @param [in]     size  配列サイズ
+   * @param [in]     guide ガイドセルサイズ
+   * @param [in]     src   入力 (REAL_TYPE)
+   */
+  static void storeS3D (STORE_TYPE* dst, const int* size, const int guide, const REAL_TYPE* src);
+  
+  /**
+   * @brief 演算型V3D配列を格納型配列へストア
+   * @param [out]    dst   出力 (STORE_TYPE)
+   * @param [in]     size  配列サイズ
+   * @param [in]     guide ガイドセルサイズ
+   * @param [in]     src   入力 (REAL_TYPE)
+   */
+  static void storeV3D (STORE_TYPE* dst, const int* size, const int guide, const REAL_TYPE* src);
+  
   
   /** 
    * @brief MediumList中に登録されているkeyに対するIDを返す
@@ -49,6 +49,19 @@
 #endif
 
 
+/** 格納型の指定
+ * - 統計量，渦粘性係数，体積率など，時間発展の精度に直接寄与しない大容量配列の格納型
+ * - デフォルトでは、STORE_TYPE=REAL_TYPE
+ * - コンパイル時オプション-D_STORE_IS_FLOAT_を付与することで
+ *   STORE_TYPE=floatになる．演算はREAL_TYPEで行い，ロード/ストア時に変換する
+ */
+#ifdef _STORE_IS_FLOAT_
+#define STORE_TYPE float
+#else
+#define STORE_TYPE REAL_TYPE
+#endif
+
+
 #define KELVIN    273.15
 #define BOLTZMAN  1.0
 
@@ -414,6 +427,7 @@ typedef struct {
   int divType;
   double divEPS;
   double divergence;
+  int deferred; ///< ONのとき，divergenceはランク内の値で集約待ち
 } DivConvergence;
 
 
@@ -499,7 +513,8 @@ enum sv_type {
 enum File_format {
   sph_fmt=0,
   bov_fmt,
-  plt3d_fun_fmt
+  plt3d_fun_fmt,
+  mpiio_fmt
 };
 
 /** 反復制御リスト */
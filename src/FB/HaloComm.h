@@ -0,0 +1,311 @@
+#ifndef _FB_HALO_COMM_H_
+#define _FB_HALO_COMM_H_
+
+//##################################################################################
+//
+// Flow Base class
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   HaloComm.h
+ * @brief  FlowBase HaloComm class Header
+ * @author aics
+ */
+
+// 使用例
+//     HaloComm hc;
+//     hc.setDomain(size, guide, nID);
+//     hc.add(d_v, 3, guide);   // ベクトル (i,j,k,3)
+//     hc.add(d_p, 1, 1);       // スカラ
+//     if ( !hc.exchange() ) Exit(0);
+//
+//   登録した配列をまとめてパックし，隣接ランクごとに1メッセージで送受信する
+//   x, y, z方向の順に通信し，後の方向では先に通信した方向のガイドセルも含めて送るので，
+//   辺と頂点のガイドセルも埋まる
+//
+// 永続通信
+//     hc.setDomain(size, guide, nID);
+//     hc.add(d_x, 1, 1);
+//     hc.commit(HaloComm::halo_sequential);  // パック表と永続リクエストを作る
+//     ...
+//     hc.bind(0, d_y);          // 同じ形状の別の配列に付け替える
+//     hc.exchange();            // MPI_Startall()で開始する
+//   halo_faceで作成すると6面を同時に通信し，post()/wait()の間に計算を挟める
+//   ただし，辺と頂点のガイドセルは更新しない
+//   halo_sequentialのpost()は最初の方向だけを開始し，残りの方向はwait()で順に通信する
+//   計算と重なるのは最初の方向のみだが，辺と頂点のガイドセルも埋まる
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "mpi.h"
+#include "FB_Define.h"
+#include "CommProgress.h"
+
+
+class HaloComm {
+
+public:
+  enum
+  {
+    max_field = 16
+  };
+
+  /** 永続通信のモード */
+  enum halo_mode
+  {
+    halo_sequential=0, ///< 方向ごとに順に通信，辺と頂点を含む
+    halo_face          ///< 6面を同時に通信，面のみ
+  };
+
+private:
+
+  /** 通信対象配列 */
+  typedef struct
+  {
+    char* ptr;   ///< 配列の先頭
+    int esz;     ///< 要素のバイト数
+    int nc;      ///< 成分数（成分が最外側のレイアウト）
+    int layer;   ///< 通信層数
+  } Field;
+
+  /** パック表の要素　i方向の連続区間 */
+  typedef struct
+  {
+    int fid;     ///< 配列番号
+    size_t ofs;  ///< 配列先頭からのバイト位置
+    size_t pos;  ///< バッファ内のバイト位置
+    size_t len;  ///< バイト数
+  } Run;
+
+  Field fld[max_field];
+  int nfld;              ///< 登録数
+  int size[3];           ///< 計算内部領域のサイズ
+  int guide;             ///< ガイドセル数
+  int nID[6];            ///< 隣接ランク番号（負値は隣接なし）
+  MPI_Comm comm;         ///< コミュニケータ
+
+  char* sbuf[2];         ///< 送信バッファ [minus, plus]
+  char* rbuf[2];         ///< 受信バッファ [minus, plus]
+  size_t buf_len;        ///< 確保済みバッファ長 (byte)
+
+  bool committed;        ///< 永続通信の作成済みフラグ
+  bool posted;           ///< post()済みフラグ
+  int pdir;              ///< halo_sequentialでpost()した方向（3は通信なし）
+  int mode;              ///< 永続通信のモード
+  bool active[3];        ///< 方向ごとの通信の有無
+  Run* run[3][2][2];     ///< パック表 [dir][side][send, recv]
+  int nrun[3][2][2];     ///< パック表の要素数
+  char* pbuf;            ///< 永続通信用バッファ
+  char* pb[3][2][2];     ///< pbuf内の各メッセージの先頭 [dir][side][send, recv]
+  MPI_Request preq[3][4];///< 永続リクエスト [dir][recv-, recv+, send-, send+]
+  CommProgress* progress;///< 通信進行スレッド（NULLのとき使わない）
+
+
+public:
+  /** コンストラクタ */
+  HaloComm() {
+    nfld    = 0;
+    guide   = 0;
+    comm    = MPI_COMM_WORLD;
+    buf_len = 0;
+
+    for (int i=0; i<3; i++) size[i] = 0;
+    for (int i=0; i<6; i++) nID[i] = -1;
+
+    for (int i=0; i<2; i++)
+    {
+      sbuf[i] = NULL;
+      rbuf[i] = NULL;
+    }
+
+    committed = false;
+    posted    = false;
+    pdir      = 3;
+    mode      = halo_sequential;
+    pbuf      = NULL;
+    progress  = NULL;
+
+    for (int d=0; d<3; d++)
+    {
+      active[d] = false;
+      for (int i=0; i<4; i++) preq[d][i] = MPI_REQUEST_NULL;
+
+      for (int s=0; s<2; s++) {
+        for (int r=0; r<2; r++) {
+          run[d][s][r]  = NULL;
+          nrun[d][s][r] = 0;
+          pb[d][s][r]   = NULL;
+        }
+      }
+    }
+  }
+
+  /**　デストラクタ */
+  ~HaloComm() {
+    release();
+    releaseBuffer();
+  }
+
+
+public:
+
+  /**
+   * @brief 領域情報を設定する
+   * @param [in] sz     計算内部領域のサイズ
+   * @param [in] gc     ガイドセル数
+   * @param [in] m_nID  隣接ランク番号
+   * @param [in] m_comm コミュニケータ
+   */
+  void setDomain(const int* sz, const int gc, const int* m_nID, MPI_Comm m_comm=MPI_COMM_WORLD);
+
+
+  /**
+   * @brief 通信対象の配列を登録する
+   * @param [in] d     配列
+   * @param [in] nc    成分数 (S3D=1, V3D=3)
+   * @param [in] layer 通信層数 (1<=layer<=guide)
+   * @retval 登録数の上限を超えたか，層数が不正の場合false
+   */
+  template <class T>
+  bool add(T* d, const int nc, const int layer)
+  {
+    return addField((char*)d, (int)sizeof(T), nc, layer);
+  }
+
+
+  /**
+   * @brief 登録済みの配列を同じ形状の別の配列に付け替える
+   * @param [in] slot 登録順の番号
+   * @param [in] d    配列
+   * @retval 番号または型が不正の場合false
+   * @note パック表は配列先頭からの相対位置なので，作り直す必要はない
+   */
+  template <class T>
+  bool bind(const int slot, T* d)
+  {
+    if ( slot < 0 || slot >= nfld || !d ) return false;
+    if ( fld[slot].esz != (int)sizeof(T) ) return false;
+    fld[slot].ptr = (char*)d;
+    return true;
+  }
+
+
+  /** @brief 登録を消去する */
+  void clear()
+  {
+    release();
+    nfld = 0;
+  }
+
+
+  /** @brief 永続通信の作成済みか */
+  bool isCommitted() const
+  {
+    return committed;
+  }
+
+
+  /** @brief 登録数 */
+  int getFields() const
+  {
+    return nfld;
+  }
+
+
+  /**
+   * @brief 登録した全配列の袖通信を行う
+   * @retval MPIのエラーの場合false
+   */
+  bool exchange();
+
+
+  /**
+   * @brief パック表と永続リクエストを作成する
+   * @param [in] m_mode halo_sequential / halo_face
+   * @retval 確保またはMPIのエラーの場合false
+   * @note 以降の登録の変更はclear()から行う
+   */
+  bool commit(const int m_mode=halo_sequential);
+
+
+  /**
+   * @brief 通信を開始する
+   * @retval MPIのエラーの場合false
+   * @note halo_faceは6面，halo_sequentialは最初の方向のみ
+   */
+  bool post();
+
+
+  /**
+   * @brief post()した通信の完了を待ち，ガイドセルに展開する
+   * @retval MPIのエラーの場合false
+   * @note halo_sequentialでは残りの方向をここで順に通信する
+   */
+  bool wait();
+
+
+  /** @brief 永続リクエストとパック表を解放する */
+  void release();
+
+
+  /**
+   * @brief 通信進行スレッドを設定する
+   * @param [in] cp CommProgressクラス（NULLのとき使わない）
+   * @note post()からwait()までの間，進行スレッドがリクエストを監視する
+   */
+  void setProgress(CommProgress* cp)
+  {
+    progress = cp;
+  }
+
+
+private:
+
+  // 配列を登録する
+  bool addField(char* d, const int esz, const int nc, const int layer);
+
+
+  // 送信または受信の範囲
+  void getRange(const Field* f, const int dir, const int side, const bool recv, const bool face, int* st, int* ed) const;
+
+
+  // 方向dirの1メッセージのバイト数
+  size_t getMessageLength(const int dir, const bool face) const;
+
+
+  // パック表を作る
+  bool makeRunTable(const int dir, const int side, const int recv);
+
+
+  // 永続通信の順次交換 d0方向から
+  bool exchangePersistent(const int d0=0);
+
+
+  // パック表によるコピー
+  void packRuns(const Run* r, const int n, char* buf) const;
+  void unpackRuns(const Run* r, const int n, const char* buf);
+
+
+  // バッファへのパック，バッファからのアンパック
+  void pack(const int dir, const int side, char* buf) const;
+  void unpack(const int dir, const int side, const char* buf);
+
+
+  // バッファの確保と解放
+  bool reserveBuffer(const size_t len);
+  void releaseBuffer();
+
+};
+
+#endif // _FB_HALO_COMM_H_
@@ -0,0 +1,156 @@
+#ifndef _FB_RANK_PROFILE_H_
+#define _FB_RANK_PROFILE_H_
+
+//##################################################################################
+//
+// Flow Base class
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   RankProfile.h
+ * @brief  FlowBase RankProfile class Header
+ * @author aics
+ */
+
+// 使用例
+//     RankProfile RP;
+//     RP.setProperties("Poisson_SOR", RankProfile::rp_calc, true);  // PMlibと同じラベル
+//     RP.start("Poisson_SOR");
+//     RP.stop("Poisson_SOR");
+//     RP.report(fp, head, size, "costmap.txt");  // 全ランクで呼ぶ
+//
+//   ランクごとに排他測定区間の時間を計算（CALC）と待ち（COMM）に分けて積算し，
+//   終了時にランク間の偏りを表示する．コストマップはASDの重み付き分割で読み込める
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <map>
+#include "mpi.h"
+
+
+class RankProfile {
+
+public:
+  enum
+  {
+    max_label = 200
+  };
+
+  /** 区間の種別 */
+  enum rp_type
+  {
+    rp_calc=0, ///< 計算
+    rp_comm    ///< 通信・待ち
+  };
+
+private:
+  int nlabel;                     ///< 登録数
+  std::map<std::string, int> key; ///< ラベルから登録番号
+  std::string label[max_label];   ///< ラベル
+  int type[max_label];            ///< 種別
+  bool excl[max_label];           ///< 排他測定フラグ
+  double t_st[max_label];         ///< 開始時刻
+  double t_acc[max_label];        ///< 積算時間
+
+public:
+  /** コンストラクタ */
+  RankProfile() {
+    nlabel = 0;
+
+    for (int i=0; i<max_label; i++)
+    {
+      type[i]  = rp_calc;
+      excl[i]  = true;
+      t_st[i]  = 0.0;
+      t_acc[i] = 0.0;
+    }
+  }
+
+  /**　デストラクタ */
+  ~RankProfile() {}
+
+
+public:
+
+  /**
+   * @brief 測定区間を登録する
+   * @param [in] m_label   ラベル
+   * @param [in] m_type    rp_calc / rp_comm
+   * @param [in] exclusive 排他測定フラグ　非排他区間は集計に含めない
+   * @retval 登録数の上限を超えた場合false
+   */
+  bool setProperties(const std::string& m_label, const int m_type, const bool exclusive)
+  {
+    if ( key.find(m_label) != key.end() ) return true;
+    if ( nlabel >= max_label ) return false;
+
+    key[m_label]  = nlabel;
+    label[nlabel] = m_label;
+    type[nlabel]  = m_type;
+    excl[nlabel]  = exclusive;
+    nlabel++;
+
+    return true;
+  }
+
+
+  /**
+   * @brief 測定開始
+   * @param [in] m_label ラベル
+   */
+  void start(const std::string& m_label)
+  {
+    std::map<std::string, int>::iterator it = key.find(m_label);
+    if ( it == key.end() ) return;
+    t_st[it->second] = MPI_Wtime();
+  }
+
+
+  /**
+   * @brief 測定終了
+   * @param [in] m_label ラベル
+   */
+  void stop(const std::string& m_label)
+  {
+    std::map<std::string, int>::iterator it = key.find(m_label);
+    if ( it == key.end() ) return;
+    t_acc[it->second] += MPI_Wtime() - t_st[it->second];
+  }
+
+
+  /**
+   * @brief ランク間の偏りを集計して表示する
+   * @param [in] fp       出力先（ランク0のみ参照，NULL可）
+   * @param [in] head     自ランクの開始インデクス（グローバル）
+   * @param [in] sz       自ランクのサイズ
+   * @param [in] map_file コストマップのファイル名（NULLのとき出力しない）
+   * @param [in] comm     コミュニケータ
+   * @retval MPIのエラーまたはファイル出力に失敗した場合false
+   * @note 全ランクで呼ぶこと
+   */
+  bool report(FILE* fp, const int* head, const int* sz, const char* map_file, MPI_Comm comm=MPI_COMM_WORLD);
+
+
+private:
+
+  // 排他区間の種別ごとの合計
+  double getSum(const double* t, const int m_type) const;
+
+  // 1項目の最大，平均，最小を表示する
+  void printStat(FILE* fp, const char* title, const double* v, const int np) const;
+
+};
+
+#endif // _FB_RANK_PROFILE_H_
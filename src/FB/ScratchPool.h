@@ -0,0 +1,249 @@
+#ifndef _FB_SCRATCH_POOL_H_
+#define _FB_SCRATCH_POOL_H_
+
+//##################################################################################
+//
+// Flow Base class
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   ScratchPool.h
+ * @brief  FlowBase ScratchPool class Header
+ * @author aics
+ */
+
+// 使用例
+// 1. 要求の登録
+//     ScratchPool sp;
+//     sp.request("vc", &d_vc, 3, ScratchPool::span(ph_predictor, ph_poisson));
+//   生存するフェイズをビットマスクで与える．内容を次のフェイズへ持ち越す場合は，
+//   その間のフェイズも含めること（span()で連続区間を作れる）
+// 2. 配置計画とアロケート
+//     sp.plan();
+//     sp.allocate(size, guide);  // 各ポインタに割り当てられる
+// 3. 削減量
+//     sp.getRequestBlocks() - sp.getPoolBlocks()
+
+#include <string.h>
+#include <stdio.h>
+#include "FB_Define.h"
+#include "Alloc.h"
+
+
+class ScratchPool {
+
+public:
+  enum
+  {
+    max_request = 32
+  };
+
+private:
+
+  /** スクラッチ配列の要求 */
+  typedef struct
+  {
+    char name[16];    ///< 表示名
+    REAL_TYPE** ptr;  ///< 割り当て先
+    int nblk;         ///< スカラ配列単位のサイズ
+    unsigned live;    ///< 生存フェイズのビットマスク
+    int offset;       ///< プール内の位置（スカラ配列単位）
+  } Request;
+
+  Request rq[max_request];
+  int nreq;          ///< 要求数
+  int nblock;        ///< プールのサイズ（スカラ配列単位）
+  REAL_TYPE* pool;   ///< プール
+
+
+public:
+  /** コンストラクタ */
+  ScratchPool() {
+    nreq   = 0;
+    nblock = 0;
+    pool   = NULL;
+  }
+
+  /**　デストラクタ */
+  ~ScratchPool() {
+    Alloc::Free(pool);
+  }
+
+
+public:
+
+  /**
+   * @brief フェイズfirstからlastまでの連続区間のマスク
+   * @param [in] first 先頭フェイズ
+   * @param [in] last  末尾フェイズ
+   */
+  static unsigned span(const int first, const int last)
+  {
+    unsigned m = 0;
+    for (int i=first; i<=last; i++) m |= (1u << i);
+    return m;
+  }
+
+
+  /**
+   * @brief スクラッチ配列を要求する
+   * @param [in] name 表示名
+   * @param [in] ptr  割り当て先ポインタのアドレス
+   * @param [in] nblk スカラ配列単位のサイズ
+   * @param [in] live 生存フェイズのビットマスク
+   * @retval 要求数の上限を超えた場合false
+   */
+  bool request(const char* name, REAL_TYPE** ptr, const int nblk, const unsigned live)
+  {
+    if ( nreq >= max_request || nblk < 1 || live == 0 ) return false;
+
+    Request* r = &rq[nreq++];
+    strncpy(r->name, name, sizeof(r->name)-1);
+    r->name[sizeof(r->name)-1] = '\0';
+    r->ptr    = ptr;
+    r->nblk   = nblk;
+    r->live   = live;
+    r->offset = -1;
+
+    return true;
+  }
+
+
+  /**
+   * @brief 生存区間の重なりから配置を決める
+   * @note 大きい要求から順に，生存フェイズが重なる配置済み要求と領域が交差しない最小の位置に置く
+   */
+  void plan()
+  {
+    int odr[max_request];
+
+    // サイズの降順，同サイズは登録順
+    for (int i=0; i<nreq; i++) odr[i] = i;
+
+    for (int i=1; i<nreq; i++)
+    {
+      int t = odr[i];
+      int j = i-1;
+      while ( j >= 0 && rq[odr[j]].nblk < rq[t].nblk )
+      {
+        odr[j+1] = odr[j];
+        j--;
+      }
+      odr[j+1] = t;
+    }
+
+    nblock = 0;
+
+    for (int i=0; i<nreq; i++)
+    {
+      Request* r = &rq[odr[i]];
+
+      // 候補位置は0と配置済み要求の直後
+      int best = -1;
+
+      for (int c=-1; c<i; c++)
+      {
+        int pos = (c < 0) ? 0 : rq[odr[c]].offset + rq[odr[c]].nblk;
+
+        if ( best >= 0 && pos >= best ) continue;
+
+        bool ok = true;
+
+        for (int j=0; j<i; j++)
+        {
+          Request* q = &rq[odr[j]];
+
+          if ( (q->live & r->live) == 0 ) continue;
+          if ( pos < q->offset + q->nblk && q->offset < pos + r->nblk )
+          {
+            ok = false;
+            break;
+          }
+        }
+
+        if ( ok ) best = pos;
+      }
+
+      r->offset = best;
+      if ( best + r->nblk > nblock ) nblock = best + r->nblk;
+    }
+  }
+
+
+  /**
+   * @brief プールを確保し，各要求のポインタを割り当てる
+   * @param [in] sz 計算内部領域のサイズ
+   * @param [in] gc ガイドセルサイズ
+   * @retval 確保に失敗した場合false
+   */
+  bool allocate(const int* sz, const int gc)
+  {
+    if ( nblock == 0 ) return true;
+
+    if ( !(pool = Alloc::Real_S4D(sz, gc, nblock)) ) return false;
+
+    size_t nx = (size_t)(sz[0] + 2*gc) * (size_t)(sz[1] + 2*gc) * (size_t)(sz[2] + 2*gc);
+
+    for (int i=0; i<nreq; i++)
+    {
+      *(rq[i].ptr) = &pool[nx * (size_t)rq[i].offset];
+    }
+
+    return true;
+  }
+
+
+  /** @brief プールのサイズ（スカラ配列単位） */
+  int getPoolBlocks() const
+  {
+    return nblock;
+  }
+
+
+  /** @brief 要求の総和（スカラ配列単位） */
+  int getRequestBlocks() const
+  {
+    int n = 0;
+    for (int i=0; i<nreq; i++) n += rq[i].nblk;
+    return n;
+  }
+
+
+  /**
+   * @brief 配置計画を表示する
+   * @param [in] fp     ファイルポインタ
+   * @param [in] phase  フェイズ名の配列
+   * @param [in] nphase フェイズ数
+   */
+  void printPlan(FILE* fp, const char** phase, const int nphase) const
+  {
+    fprintf(fp, "\tScratch arrays : requested %d, pooled %d (scalar arrays)\n", getRequestBlocks(), nblock);
+    fprintf(fp, "\t  %-12s %6s %6s   Live phase\n", "Name", "Offset", "Size");
+
+    for (int i=0; i<nreq; i++)
+    {
+      fprintf(fp, "\t  %-12s %6d %6d  ", rq[i].name, rq[i].offset, rq[i].nblk);
+
+      for (int p=0; p<nphase; p++)
+      {
+        if ( rq[i].live & (1u << p) ) fprintf(fp, " %s", phase[p]);
+      }
+      fprintf(fp, "\n");
+    }
+
+    fflush(fp);
+  }
+
+};
+
+#endif // _FB_SCRATCH_POOL_H_
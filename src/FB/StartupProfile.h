@@ -0,0 +1,129 @@
+#ifndef _FB_STARTUP_PROFILE_H_
+#define _FB_STARTUP_PROFILE_H_
+
+//##################################################################################
+//
+// Flow Base class
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   StartupProfile.h
+ * @brief  FlowBase StartupProfile class Header
+ * @author aics
+ */
+
+// 使用例
+//     StartupProfile SU;
+//     SU.start("Initialize");
+//       SU.start("Fill");  ...  SU.stop("Fill");   // 入れ子で階層になる
+//     SU.stop("Initialize");
+//     SU.finish();                                  // 以降のstart/stopは無視
+//     SU.report(stdout, "startup_profile.json");    // 全ランクで呼ぶ
+//
+//   初期化のフェイズごとに経過時間と終了時のRSS，ピークRSSを記録し，
+//   ランク間の最小・平均・最大を表とJSONで出力する．
+//   同じ親の下で同じラベルを繰り返した場合は時間を積算し，呼び出し回数を数える
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <map>
+#include "mpi.h"
+
+
+class StartupProfile {
+
+public:
+  enum
+  {
+    max_phase = 256,
+    max_depth = 16
+  };
+
+private:
+  bool active;                    ///< 記録中
+  int nphase;                     ///< 登録数
+  std::map<std::string, int> key; ///< 階層パスから登録番号
+  std::string path[max_phase];    ///< 階層パス（"/"区切り）
+  std::string name[max_phase];    ///< ラベル
+  int depth[max_phase];           ///< 階層の深さ
+  int calls[max_phase];           ///< 呼び出し回数
+  double t_first[max_phase];      ///< 最初の開始時刻（原点からの経過時間）
+  double t_st[max_phase];         ///< 開始時刻
+  double t_acc[max_phase];        ///< 積算時間
+  double rss[max_phase];          ///< 終了時のRSS [MB]
+  double hwm[max_phase];          ///< 終了時のピークRSS [MB]
+  int stack[max_depth];           ///< 実行中のフェイズ
+  int nstack;                     ///< スタックの深さ
+  double t_origin;                ///< 時刻の原点
+
+public:
+  /** コンストラクタ */
+  StartupProfile() {
+    active   = true;
+    nphase   = 0;
+    nstack   = 0;
+    t_origin = -1.0;
+
+    for (int i=0; i<max_phase; i++)
+    {
+      depth[i]   = 0;
+      calls[i]   = 0;
+      t_first[i] = 0.0;
+      t_st[i]    = 0.0;
+      t_acc[i]   = 0.0;
+      rss[i]     = 0.0;
+      hwm[i]     = 0.0;
+    }
+  }
+
+  /**　デストラクタ */
+  ~StartupProfile() {}
+
+
+public:
+
+  // フェイズの開始
+  void start(const std::string& m_label);
+
+
+  // フェイズの終了
+  void stop(const std::string& m_label);
+
+
+  // 実行中のフェイズをすべて閉じ，記録を終える
+  void finish();
+
+
+  /**
+   * @brief 記録中かどうか
+   */
+  bool isActive() const
+  {
+    return active;
+  }
+
+
+  // ランク間で集計し，表とJSONを出力する
+  bool report(FILE* fp, const char* json_file, MPI_Comm comm=MPI_COMM_WORLD);
+
+
+private:
+
+  // 現在のRSSとピークRSSを取得する [MB]
+  static void getMemory(double& m_rss, double& m_hwm);
+
+};
+
+#endif // _FB_STARTUP_PROFILE_H_
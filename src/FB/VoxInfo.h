@@ -41,11 +41,26 @@ class VoxInfo : public DomainInfo {
   
 private:
   Intrinsic *Ex;       ///< 例題クラスのポインタ
+  
+  unsigned long cc_count[32]; ///< セルセンターIDごとのセル数 scanCensus()で集計
+  int cc_bbox[32][6];         ///< セルセンターIDごとのbbox (st[3], ed[3])
+  int cf_bbox[32][6];         ///< 交点IDごとのbbox（いずれかの面にそのIDをもつセル）
 
 public:
   /** コンストラクタ */
   VoxInfo() {
     Ex = NULL;
+    
+    for (int n=0; n<32; n++)
+    {
+      cc_count[n] = 0;
+      
+      for (int l=0; l<6; l++)
+      {
+        cc_bbox[n][l] = 0;
+        cf_bbox[n][l] = 0;
+      }
+    }
   }
   
   /**　デストラクタ */
@@ -53,6 +68,10 @@ public:
   
 private:
   
+  // セルセンターIDと交点IDごとのセル数とbboxを1回の走査で集計する
+  void scanCensus (const int* bcd, const int* bid);
+  
+  
   // 外部境界に接するガイドセルのbcd[]にIDを内部周期境界からコピーする
   void copyIdPrdcInner (int* bcd, const int* m_st, const int* m_ed, const int m_id, const int m_dir);
   
@@ -132,6 +151,25 @@ private:
   void encVbitOBC (int face, int* cdf, string key, const bool enc_sw, string chk, int* bid, bool enc_uwd=false);
   
   
+  //@brief bbox b[6] (st[3], ed[3]) をセル(i,j,k)を含むように広げる
+  inline void extendBbox (int* b, const int i, const int j, const int k)
+  {
+    if ( i < b[0] ) b[0] = i;
+    if ( j < b[1] ) b[1] = j;
+    if ( k < b[2] ) b[2] = k;
+    if ( i > b[3] ) b[3] = i;
+    if ( j > b[4] ) b[4] = j;
+    if ( k > b[5] ) b[5] = k;
+  }
+  
+  
+  //@brief 交点IDのbbox (st[3], ed[3])．5bitで表せないIDは空の範囲
+  inline const int* getCutBbox (const int odr) const
+  {
+    return cf_bbox[ (odr > 0 && odr < 32) ? odr : 0 ];
+  }
+  
+  
   //@brief idxの第shiftビットをOFFにする
   inline int offBit (int idx, const int shift)
   {
@@ -310,7 +348,7 @@ public:
    */
   void setCmpFraction(CompoList* cmp,
                       int* bx,
-                      const REAL_TYPE* vf,
+                      const STORE_TYPE* vf,
                       const int m_NoCompo);
   
   
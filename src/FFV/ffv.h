@@ -29,6 +29,11 @@
  */
 
 #include "ffv_Alloc.h"
+#include "Alloc.h"
+#include "HaloComm.h"
+#include "CommProgress.h"
+#include "RankProfile.h"
+#include "StartupProfile.h"
 #include <math.h>
 #include <float.h>
 
@@ -54,10 +59,12 @@
 #include "Geometry.h"
 #include "Glyph.h"
 #include "CompoFraction.h"
+#include "StlScatter.h"
 
 // FileIO class
 #include "ffv_sph.h"
 #include "ffv_plot3d.h"
+#include "GeomCache.h"
 
 // Intrinsic class
 #include "IP_Duct.h"
@@ -131,7 +138,7 @@ private:
   double CurrentTime;           ///< 計算開始からの積算時刻（ケース）
   double CurrentTimeStat;       ///< 統計値操作の積算時間（ケース）
   unsigned CurrentStep;         ///< 計算開始からの積算ステップ（ケース）
-  unsigned CurrentStepStat;     ///< 統計操作の積算ステップ数（ケース）
+  unsigned CurrentStepStat;     ///< 統計操作の積算サンプル数（ケース）
   unsigned Session_CurrentStep; ///< セッションの現在のステップ
   unsigned Session_LastStep;    ///< セッションの終了ステップ数
   
@@ -141,6 +148,8 @@ private:
   
   int communication_mode; ///< synchronous, asynchronous
   
+  HaloComm hc_vel[4];     ///< 速度ベクトルの永続通信 [1層 順次, 1層 面, guide層 順次, guide層 面]
+  
   REAL_TYPE v00[4];      ///< 参照速度
   REAL_TYPE range_Ut[2]; ///< 
   REAL_TYPE range_Yp[2]; ///<
@@ -187,6 +196,9 @@ private:
   MediumList* mat;           ///< 媒質リスト
   CompoList* cmp;            ///< コンポーネントリスト
   PerfMonitor PM;            ///< 性能モニタクラス
+  RankProfile RP;            ///< ランクごとの計算・待ち時間
+  StartupProfile SU;         ///< 初期化フェイズの時間とメモリ
+  CommProgress CP;           ///< 通信進行スレッド
   VoxInfo V;                 ///< ボクセル前処理クラス
   ParseBC B;                 ///< 境界条件のパースクラス
   SetBC3D BC;                ///< BCクラス
@@ -197,6 +209,7 @@ private:
   MonitorList MO;            ///< Monitorクラス
   IO_BASE* F;                ///< File IO class
   Geometry GM;               ///< Geometry class
+  GeomCache GC;              ///< 形状前処理のキャッシュ
   
   LinearSolver LS[ic_END];   ///< 反復解法
   
@@ -228,7 +241,14 @@ private:
   inline void TIMING_start(const string key)
   {
     // PMlib Intrinsic profiler
-    TIMING__ PM.start(key);
+    TIMING__
+    {
+      PM.start(key);
+      RP.start(key);
+    }
+    
+    // 初期化フェイズの記録 >> Initialize()の終了後は無視される
+    SU.start(key);
     
     const char* s_label = key.c_str();
     
@@ -259,7 +279,13 @@ private:
 #endif
     
     // PMlib Intrinsic profiler
-    TIMING__ PM.stop(key, flopPerTask, (unsigned)iterationCount);
+    TIMING__
+    {
+      PM.stop(key, flopPerTask, (unsigned)iterationCount);
+      RP.stop(key);
+    }
+    
+    SU.stop(key);
   }
   
   
@@ -268,7 +294,7 @@ private:
   /** ffv_Initialize.C *******************************************************/
   
   // 主計算に用いる配列の確保
-  void allocate_Main(double &total);
+  void allocate_Main(double &total, double &saved);
   
   
   // 全Voxelモデルの媒質数とKOSの整合性をチェック
@@ -288,7 +314,7 @@ private:
   
   
   // メモリ使用量の表示
-  void displayMemoryInfo(FILE* fp, double G_mem, double L_mem, const char* str);
+  void displayMemoryInfo(FILE* fp, double G_mem, double L_mem, const char* str, double L_saved=0.0);
   
   
   // 制御パラメータ，物理パラメータの表示
@@ -335,6 +361,10 @@ private:
   void initInterval();
   
   
+  // 形状前処理のキャッシュを読み込む
+  void loadGeomCache(FILE* fp);
+  
+  
   
   // 線形ソルバークラス関連の初期化
   void LS_initialize(double& TotalMemory, TextParser* tpCntl);
@@ -363,6 +393,10 @@ private:
   void printGlobalDomain(FILE* fp);
   
   
+  // 形状前処理の結果をキャッシュに保存する
+  void saveGeomCache(FILE* fp);
+  
+  
   // 外部境界条件を読み込み，Controlクラスに保持する
   void setBCinfo();
   
@@ -419,6 +453,14 @@ private:
   void SetModel(double& PrepMemory, double& TotalMemory, FILE* fp);
   
   
+  // ポリゴンを全ランクで分割して読み込む
+  bool loadPolygonParallel(FILE* fp);
+  
+  
+  // 分配したランクごとのSTLを消す
+  void removeScatteredSTL(const int k_last);
+  
+  
   // 幾何形状情報を準備し，交点計算を行う
   void SM_Polygon2Cut(double& m_prep, double& m_total, FILE* fp);
   
@@ -433,7 +475,20 @@ private:
   
   
   // OBSTACLEコンポーネントの力の成分を計算し、集める
-  void calcForce(double& flop);
+  // sample : 統計のサンプリングステップのとき，力の時間平均に積算する
+  void calcForce(double& flop, const bool sample);
+  
+  
+  // 交点セルの登録からコンポーネントに働く力を計算する
+  void forceCompoCut(REAL_TYPE* frc, const int tgt, const int* st, const int* ed, double& flop);
+  
+  
+  // 計算領域を外殻と内部に分割する
+  int divideShell(const int width, int st[][3], int ed[][3]);
+  
+  
+  // 速度ベクトルの袖通信エンジンを返す
+  HaloComm* getVelocityHalo(REAL_TYPE* d, const int layer, const int mode);
   
   
   // 外部計算領域の各面における総流量と対流流出速度を計算する
@@ -441,7 +496,7 @@ private:
   
   
   // div(u)を計算する
-  void NormDiv(REAL_TYPE* div);
+  void NormDiv(REAL_TYPE* div, const bool deferred=false);
   
   
   // タイミング測定区間にラベルを与えるラッパー
@@ -460,9 +515,13 @@ private:
   void Usage();
   
   
-  // 空間平均操作と変動量の計算を行う
+  // 空間平均操作と変動量，速度成分の最大値の計算を行う
   // スカラ値は算術平均，ベクトル値は自乗和
-  void VariationSpace(double* rms, double* avr, double& flop);
+  void VariationSpace(double* rms, double* avr, REAL_TYPE& vmax, double& flop);
+  
+  
+  // VariationSpace()のユーザ定義リダクションを解放する
+  void freeDiagOp();
   
   
   
@@ -25,6 +25,8 @@
 
 #include "DomainInfo.h"
 #include "Control.h"
+#include "ScratchPool.h"
+#include "CutStore.h"
 #include "ffv_Define.h"
 
 
@@ -35,6 +37,8 @@ class FALLOC : public DomainInfo {
 private:
   double array_size;
   
+  ScratchPool SP;   ///< スクラッチ配列の配置
+  
   
 public:
   
@@ -58,18 +62,18 @@ public:
   REAL_TYPE *d_dv;  ///< [*] \sum{u}の保存
   REAL_TYPE *d_ie;  ///< [*] 内部エネルギー
   
-  REAL_TYPE *d_wv;  ///<     ワーク配列, file IO用のバッファには使わない
-  
-  REAL_TYPE *d_io_buffer; ///< 大きなバッファ　以下と共用
-  // >> file IO用のバッファと共用
+  // >> スクラッチ配列 生存するフェイズが重ならないもの同士で領域を共用 FALLOC::allocArray_Scratch()
+  REAL_TYPE *d_wv;  ///<     ワーク配列, 疑似速度とfile IOのワーク
+  REAL_TYPE *d_io_buffer; ///< file IO用の大きなバッファ
   REAL_TYPE *d_vc;  ///<     セルセンター疑似速度
   REAL_TYPE *d_v0;  ///<     n-stepの速度保持
   REAL_TYPE *d_p0;  ///<     圧力（1ステップ前）
   REAL_TYPE *d_sq;  ///<     反復中に変化するソース
   REAL_TYPE *d_b;   ///<     Ax=bの右辺ベクトル
-  REAL_TYPE *d_ie0; ///<     内部エネルギー（1ステップ前）
+  REAL_TYPE *d_ie0; ///< [*] 内部エネルギー（1ステップ前）
   REAL_TYPE *d_qbc; ///<     熱BC flux保持
-  // << file IO用のバッファと共用
+  REAL_TYPE *d_wt;  ///<     統計処理のワーク
+  // << スクラッチ配列
   
   
   // 渦度関連オプション
@@ -78,19 +82,19 @@ public:
   // Polygon
   long long  *d_cut;    ///< [*] 距離情報
   int        *d_bid;    ///< [*] BC
+  CutStore   CS;        ///< [*] 交点セルの疎な保持 >> 前処理後にd_cut/d_bidを解放した場合に参照
   
   
   // 平均値
   REAL_TYPE *d_ap;         ///< [*] 圧力（時間平均値）
-  REAL_TYPE *d_av;         ///< [*] 速度（時間平均値）
+  STORE_TYPE *d_av;        ///< [*] 速度（時間平均値）
   REAL_TYPE *d_ae;         ///< [*] 内部エネルギー（時間平均値）
 
-  REAL_TYPE *d_R;          ///< [*] レイノルズ応力テンソル
-  REAL_TYPE *d_aR;         ///< [*] レイノルズ応力テンソル (時間平均値)
-  REAL_TYPE *d_aP;         ///< [*] 生成項 (時間平均値)
-  REAL_TYPE *d_aE;         ///< [*] 散逸項 (時間平均値)
-  REAL_TYPE *d_aT;         ///< [*] 乱流拡散項 (時間平均値)
-  REAL_TYPE *d_aPI;        ///< [*] 速度圧力勾配相関項 (時間平均値)
+  STORE_TYPE *d_aR;        ///< [*] レイノルズ応力テンソル (時間平均値)
+  STORE_TYPE *d_aP;        ///< [*] 生成項 (時間平均値)
+  STORE_TYPE *d_aE;        ///< [*] 散逸項 (時間平均値)
+  STORE_TYPE *d_aT;        ///< [*] 乱流拡散項 (時間平均値)
+  STORE_TYPE *d_aPI;       ///< [*] 速度圧力勾配相関項 (時間平均値)
 
   REAL_TYPE *d_av_mean;    ///< [*] 速度（時間・主流方向・スパン方向平均値）
   REAL_TYPE *d_arms_mean;  ///< [*] 乱流強度（時間・主流方向・スパン方向平均値）
@@ -113,19 +117,19 @@ public:
   
   // Components
   REAL_TYPE** component_array; ///< コンポーネントワーク配列のアドレス管理
-  REAL_TYPE *d_cvf; ///< [*] 体積率
+  STORE_TYPE *d_cvf; ///< [*] 体積率
   
   
   // LES計算
-  REAL_TYPE *d_vt;      ///< [*] 渦粘性係数
+  STORE_TYPE *d_vt;     ///< [*] 渦粘性係数
   
   // 統計
-  REAL_TYPE *d_rms_v;      ///< [*] セルセンター速度の乱流強度
-  REAL_TYPE *d_rms_mean_v; ///< [*] セルセンター速度の時間平均乱流強度
-  REAL_TYPE *d_rms_p;      ///< [*] 圧力の変動強度
-  REAL_TYPE *d_rms_mean_p; ///< [*] 圧力の時間平均変動強度
-  REAL_TYPE *d_rms_t;      ///< [*] 温度の変動強度
-  REAL_TYPE *d_rms_mean_t; ///< [*] 温度の時間平均変動強度
+  STORE_TYPE *d_rms_v;      ///< [*] セルセンター速度の乱流強度
+  STORE_TYPE *d_rms_mean_v; ///< [*] セルセンター速度の時間平均乱流強度
+  STORE_TYPE *d_rms_p;      ///< [*] 圧力の変動強度
+  STORE_TYPE *d_rms_mean_p; ///< [*] 圧力の時間平均変動強度
+  STORE_TYPE *d_rms_t;      ///< [*] 温度の変動強度
+  STORE_TYPE *d_rms_mean_t; ///< [*] 温度の時間平均変動強度
   
   
   // 界面計算
@@ -140,14 +144,14 @@ public:
   REAL_TYPE *cf_z;  ///<     k方向のバッファ
   
   
-  // GMRES
+  // GMRES >> スクラッチ配列
   REAL_TYPE * d_wg;   ///< テンポラリの配列 [size]
   REAL_TYPE * d_res;  ///< 残差 = b - Ax
   REAL_TYPE * d_vm;   ///< Kryolov subspaceの直交基底 [size*FREQ_OF_RESTART]
   REAL_TYPE * d_zm;   ///< Right-hand side vector for the residual minimization problem [size*FREQ_OF_RESTART]
   
   
-  // PCG & BiCGstab
+  // PCG & BiCGstab >> スクラッチ配列
   REAL_TYPE *d_pcg_r;
   REAL_TYPE *d_pcg_p;
   
@@ -202,6 +206,7 @@ public:
     d_b = NULL;
     d_ie = NULL;
     d_ie0 = NULL;
+    d_wt = NULL;
     d_vrt = NULL;
     
     d_vof = NULL;
@@ -218,7 +223,6 @@ public:
     d_rms_mean_p = NULL;
     d_rms_mean_t = NULL;
     
-    d_R   = NULL;
     d_aR  = NULL;
     d_aP  = NULL;
     d_aE  = NULL;
@@ -300,10 +304,6 @@ public:
   void allocArray_Interface(double &total);
   
   
-  // Krylov-subspace法に用いる配列のアロケーション
-  void allocArray_Krylov(double &total);
-  
-  
   // LES計算に用いる配列のアロケーション
   void allocArray_LES(double &total);
   
@@ -316,24 +316,24 @@ public:
   void allocArray_Main(double &total, Control* C);
   
   
-  // PCG法に用いる配列のアロケーション
-  void allocArray_PCG(double &total);
-  
-  
-  // BiCGSTAB法に用いる配列のアロケーション
-  void allocArray_BiCGstab(double &total);
+  // 前処理に用いる配列のアロケーション
+  void allocArray_Prep(double &prep, double &total);
   
   
-  // BiCGSTAB /w preconditionning に用いる配列のアロケーション
-  void allocArray_BiCGSTABwithPreconditioning(double &total);
+  // スクラッチ配列の配置を決めてアロケーション
+  void allocArray_Scratch(double &total, double &saved, Control* C, const int ls_prs, const bool precond);
   
   
-  // 前処理に用いる配列のアロケーション
-  void allocArray_Prep(double &prep, double &total);
+  // スクラッチ配列の配置の表示
+  void printScratchPlan(FILE* fp);
   
   
   // SOR2SMAのバッファ確保
   void allocate_SOR2SMA_buffer(double &total);
+  
+  
+  // 前処理後に不要なカット情報の配列を解放
+  double releaseArray_Cut(double &total, const bool keep_cut, const bool keep_bid);
 
   
   // スカラの配列サイズを計算
@@ -26,10 +26,24 @@
 
 
 // PLOT3DのときのIOバッファのブロックサイズ
-// FALLOC::allocArray_Main()
+// FALLOC::allocArray_Scratch()
 #define IO_BLOCK_SIZE_FLOW 9
 #define IO_BLOCK_SIZE_HEAT 16
 
+
+// スクラッチ配列の生存区間を表す1ステップ内のフェイズ（実行順）
+// FALLOC::allocArray_Scratch()
+enum scratch_phase
+{
+  ph_predictor=0, ///< 疑似速度の計算
+  ph_poisson,     ///< Poissonソース，VP反復，射影
+  ph_heat,        ///< 熱輸送
+  ph_utility,     ///< 監視量，統計処理
+  ph_output,      ///< ファイル出力
+  ph_monitor,     ///< 全圧，サンプリング
+  ph_END
+};
+
 // PMlibの登録ラベル個数
 #define PM_NUM_MAX 200
 
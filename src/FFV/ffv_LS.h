@@ -25,6 +25,8 @@
 
 #include "FB_Define.h"
 #include "DomainInfo.h"
+#include "HaloComm.h"
+#include "RankProfile.h"
 #include "IterationControl.h"
 #include "Control.h"
 #include "ffv_Ffunc.h"
@@ -53,6 +55,8 @@ private:
   Control* C;        ///< Controlクラス
   SetBC3D* BC;       ///< BCクラス
   PerfMonitor* PM;   ///< PerfMonitor class
+  RankProfile* RP;   ///< ランクごとの計算・待ち時間
+  CommProgress* CP;  ///< 通信進行スレッド
   int* bcp;          ///< BCindex P
   int* bcd;          ///< BCindex ID
   
@@ -71,6 +75,8 @@ private:
   REAL_TYPE *cf_y;  ///< j方向のバッファ
   REAL_TYPE *cf_z;  ///< k方向のバッファ
   
+  HaloComm hc_sync[2]; ///< SyncScalar()の永続通信 [1層, 2層]
+  
 public:
   
   /** コンストラクタ */
@@ -78,6 +84,8 @@ public:
     C   = NULL;
     BC  = NULL;
     PM  = NULL;
+    RP  = NULL;
+    CP  = NULL;
     bcp = NULL;
     bcd = NULL;
     pcg_p  = NULL;
@@ -150,6 +158,7 @@ protected:
    * @brief 反復の同期処理
    * @param [in,out] d_class   対象データ
    * @param [in]     num_layer 通信の袖数
+   * @note 層数ごとに永続通信を初回に作成し，以降は配列を付け替えて使う
    */
   void SyncScalar(REAL_TYPE* d_class, const int num_layer);
 
@@ -162,7 +171,11 @@ protected:
   inline void TIMING_start(const string key)
   {
     // PMlib Intrinsic profiler
-    TIMING__ PM->start(key);
+    TIMING__
+    {
+      PM->start(key);
+      if ( RP ) RP->start(key);
+    }
     
     const char* s_label = key.c_str();
     
@@ -193,7 +206,11 @@ protected:
 #endif
     
     // PMlib Intrinsic profiler
-    TIMING__ PM->stop(key, flopPerTask, (unsigned)iterationCount);
+    TIMING__
+    {
+      PM->stop(key, flopPerTask, (unsigned)iterationCount);
+      if ( RP ) RP->stop(key);
+    }
   }
   
   
@@ -246,6 +263,26 @@ public:
                   REAL_TYPE* cf_z);
   
   
+  /**
+   * @brief ランクごとの計測クラスを設定する
+   * @param [in] m_RP  RankProfileクラス
+   */
+  void setRankProfile(RankProfile* m_RP)
+  {
+    RP = m_RP;
+  }
+  
+  
+  /**
+   * @brief 通信進行スレッドを設定する
+   * @param [in] m_CP  CommProgressクラス（NULLのとき使わない）
+   */
+  void setCommProgress(CommProgress* m_CP)
+  {
+    CP = m_CP;
+  }
+  
+  
   /** 
    * @brief SOR法
    * @retval 反復数
@@ -198,7 +198,7 @@ public:
                       double& flop);
   
   
-  void mod_Dir_Forcing (REAL_TYPE* d_v, int* d_bd, REAL_TYPE* d_cvf, REAL_TYPE* v00, double& flop);
+  void mod_Dir_Forcing (REAL_TYPE* d_v, int* d_bd, STORE_TYPE* d_cvf, REAL_TYPE* v00, double& flop);
   
   
   /**
@@ -239,7 +239,7 @@ public:
   void mod_Psrc_Forcing (REAL_TYPE* s_1,
                          REAL_TYPE* v,
                          int* bd,
-                         REAL_TYPE* cvf,
+                         STORE_TYPE* cvf,
                          REAL_TYPE* v00,
                          REAL_TYPE** c_array,
                          double& flop);
@@ -263,7 +263,50 @@ public:
                     REAL_TYPE* v00,
                     double& flop);
   
-  void mod_Pvec_Forcing (REAL_TYPE* d_vc, REAL_TYPE* d_v, int* d_bd, REAL_TYPE* d_cvf, REAL_TYPE* v00, REAL_TYPE dt, double& flop);
+  
+  /**
+   * @brief 内部速度境界条件による流束の修正
+   * @param [in,out] wv     疑似速度ベクトル u^*
+   * @param [in]     v      セルセンター速度ベクトル u^n
+   * @param [in]     d_cdf  BCindex C
+   * @param [in]     tm     無次元時刻
+   * @param [in]     C      Control class
+   * @param [in]     v00    基準速度
+   * @param [in]     rs     対象領域の開始インデクス
+   * @param [in]     re     対象領域の終了インデクス
+   * @param [in,out] flop   flop count
+   * @note 各コンポーネントのBboxを対象領域でクリップして処理する
+   */
+  void modPvecFluxInner (REAL_TYPE* wv,
+                         REAL_TYPE* v,
+                         int* d_cdf,
+                         const double tm,
+                         Control* C,
+                         REAL_TYPE* v00,
+                         const int* rs,
+                         const int* re,
+                         double& flop);
+  
+  
+  /**
+   * @brief 外部速度境界条件による流束の修正
+   * @param [in,out] wv     疑似速度ベクトル u^*
+   * @param [in]     v      セルセンター速度ベクトル u^n
+   * @param [in]     d_cdf  BCindex C
+   * @param [in]     tm     無次元時刻
+   * @param [in]     C      Control class
+   * @param [in]     v00    基準速度
+   * @param [in,out] flop   flop count
+   */
+  void modPvecFluxOuter (REAL_TYPE* wv,
+                         REAL_TYPE* v,
+                         int* d_cdf,
+                         const double tm,
+                         Control* C,
+                         REAL_TYPE* v00,
+                         double& flop);
+  
+  void mod_Pvec_Forcing (REAL_TYPE* d_vc, REAL_TYPE* d_v, int* d_bd, STORE_TYPE* d_cvf, REAL_TYPE* v00, REAL_TYPE dt, double& flop);
   
   /**
    * @brief 圧力損失部によるセルセンタ速度の修正と速度の発散値の修正
@@ -280,7 +323,7 @@ public:
    */
   void mod_Vdiv_Forcing (REAL_TYPE* v,
                          int* bd,
-                         REAL_TYPE* cvf,
+                         STORE_TYPE* cvf,
                          REAL_TYPE* dv,
                          REAL_TYPE dt,
                          REAL_TYPE* v00,
@@ -0,0 +1,220 @@
+#ifndef _FFV_ASYNC_WRITER_H_
+#define _FFV_ASYNC_WRITER_H_
+
+//##################################################################################
+//
+// FFV-C : Frontflow / violet Cartesian
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+//
+
+/**
+ * @file   AsyncWriter.h
+ * @brief  Asynchronous field output Class Header
+ * @author aics
+ */
+
+// 使用例
+//     AsyncWriter AW;
+//     AW.start(size, guide, nvar, depth, func, this);  // 退避領域をdepth個確保し，出力スレッドを起動
+//     ...
+//     AsyncWriter::Slot* s = AW.acquire();  // 空きがなければ出力の完了を待つ
+//     (s->bufへ場をコピー)
+//     AW.commit(s);                          // 出力スレッドがfunc(owner, s)を呼ぶ
+//     ...
+//     AW.flush();                            // 投入済みの出力の完了を待つ
+//     AW.stop();                             // MPI_Finalize()の前に呼ぶ
+//
+//   ファイル出力を時間積分と重ねるためのスレッド．投入順に1つずつ出力する
+//   出力スレッドからMPIを呼ぶ場合は，MPI_THREAD_MULTIPLEが必要（main()のMPI_Init_thread()で要求する）
+
+#include <pthread.h>
+#include "mpi.h"
+#include "FB_Define.h"
+
+
+class AsyncWriter {
+
+public:
+
+  /** 退避領域 */
+  typedef struct
+  {
+    REAL_TYPE* buf;   ///< 場の退避領域
+    unsigned step;    ///< ステップ
+    double time;      ///< 時刻
+    REAL_TYPE v00[4]; ///< 参照速度
+  } Slot;
+
+  /** 出力関数 */
+  typedef void (*WriteFunc)(void* owner, Slot* s);
+
+  enum
+  {
+    max_depth = 8
+  };
+
+private:
+
+  Slot slot[max_depth];
+  int state[max_depth];   ///< 0:空き, 1:書き込み中, 2:出力待ち
+  int ring[max_depth];    ///< 出力待ちの順序
+  int depth;              ///< 退避領域の数
+  int head;               ///< ringの先頭
+  int nqueue;             ///< 出力待ちの数
+  bool busy;              ///< 出力中
+  int dnum;               ///< 退避領域あたりの変数の数
+
+  WriteFunc func;         ///< 出力関数
+  void* owner;            ///< 出力関数に渡すポインタ
+  int nthread;            ///< 出力スレッド内のOpenMPスレッド数
+
+  pthread_t th;           ///< 出力スレッド
+  pthread_mutex_t mtx;    ///< キューの排他
+  pthread_cond_t cnd_work;///< 投入の通知
+  pthread_cond_t cnd_free;///< 完了の通知
+  bool running;           ///< 起動済みフラグ
+  bool quit;              ///< 終了要求
+
+  unsigned long n_write;  ///< 出力回数
+  unsigned long n_stall;  ///< 空き待ちの回数
+  double t_stall;         ///< 空き待ちの時間
+
+
+public:
+  /** コンストラクタ */
+  AsyncWriter() {
+    depth   = 0;
+    head    = 0;
+    nqueue  = 0;
+    busy    = false;
+    dnum    = 0;
+    func    = NULL;
+    owner   = NULL;
+    nthread = 1;
+    running = false;
+    quit    = false;
+    n_write = 0;
+    n_stall = 0;
+    t_stall = 0.0;
+
+    for (int i=0; i<max_depth; i++)
+    {
+      slot[i].buf  = NULL;
+      slot[i].step = 0;
+      slot[i].time = 0.0;
+      state[i]     = 0;
+      ring[i]      = 0;
+    }
+
+    pthread_mutex_init(&mtx, NULL);
+    pthread_cond_init(&cnd_work, NULL);
+    pthread_cond_init(&cnd_free, NULL);
+  }
+
+  /**　デストラクタ */
+  ~AsyncWriter() {
+    stop();
+    pthread_cond_destroy(&cnd_free);
+    pthread_cond_destroy(&cnd_work);
+    pthread_mutex_destroy(&mtx);
+  }
+
+
+public:
+
+  /**
+   * @brief MPIのスレッドサポートが出力スレッドに足りるか
+   */
+  static bool isAvailable()
+  {
+    int provided = MPI_THREAD_SINGLE;
+    if ( MPI_Query_thread(&provided) != MPI_SUCCESS ) return false;
+    return ( provided == MPI_THREAD_MULTIPLE );
+  }
+
+
+  // 退避領域を確保し，出力スレッドを起動する
+  bool start(const int* sz,
+             const int gc,
+             const int m_dnum,
+             const int m_depth,
+             WriteFunc m_func,
+             void* m_owner,
+             const int m_nthread=1);
+
+
+  // 空いている退避領域を得る
+  Slot* acquire();
+
+
+  // 退避領域を出力待ちに加える
+  void commit(Slot* s);
+
+
+  // 投入済みの出力の完了を待つ
+  void flush();
+
+
+  // 出力待ちを全て出力してからスレッドを停止する
+  void stop();
+
+
+  /** @brief 起動済みか */
+  bool isRunning() const
+  {
+    return running;
+  }
+
+
+  /** @brief 退避領域の数 */
+  int getDepth() const
+  {
+    return depth;
+  }
+
+
+  /** @brief 出力回数 */
+  unsigned long getWriteCount() const
+  {
+    return n_write;
+  }
+
+
+  /** @brief 空き待ちの回数 */
+  unsigned long getStallCount() const
+  {
+    return n_stall;
+  }
+
+
+  /** @brief 空き待ちの時間 [sec] */
+  double getStallTime() const
+  {
+    return t_stall;
+  }
+
+
+private:
+
+  // スレッドの本体
+  static void* entry(void* arg);
+
+  // 出力ループ
+  void loop();
+
+  // 退避領域を解放する
+  void release();
+
+};
+
+#endif // _FFV_ASYNC_WRITER_H_
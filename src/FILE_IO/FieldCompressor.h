@@ -0,0 +1,162 @@
+#ifndef _FFV_FIELD_COMPRESSOR_H_
+#define _FFV_FIELD_COMPRESSOR_H_
+
+//##################################################################################
+//
+// FFV-C : Frontflow / violet Cartesian
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   FieldCompressor.h
+ * @brief  FieldCompressor class Header
+ * @author aics
+ */
+
+// 場の配列の圧縮（外部ライブラリなし）
+//
+//   配列を固定長のブロックに分け，ブロック毎に独立に符号化する．ブロックはOpenMPで並列に処理する
+//
+//   可逆   : 同じ成分の直前の値とのXOR -> バイトシャッフル -> ランレングス（リテラル/反復）
+//   非可逆 : 約2*tolの格子に量子化し，同じ成分の直前の値との差をブロック毎のビット幅で詰める
+//            誤差は全要素で|復元値 - 元の値| <= tol．保証できないブロックは可逆で符号化する
+//
+//   圧縮率は場の滑らかさで大きく変わる．乱れを含む単精度の場で測った値は，可逆で1.2-1.3倍，
+//   非可逆（tol=1e-3）で3-5倍程度であり，3-10倍には届かない
+//
+//   符号列
+//     ヘッダ(40byte) : "FCZ1", モード, 要素のバイト数, 成分の間隔, 要素数, ブロック長, tol
+//     ブロック毎の符号長 (uint64 x ブロック数)
+//     ブロックの符号（先頭1byteが方式 0:無圧縮, 1:可逆, 2:量子化）
+//   バイト順は書き出した計算機のもの
+
+#include <stddef.h>
+#include "FB_Define.h"
+
+
+class FieldCompressor {
+
+public:
+
+  /** 圧縮モード */
+  enum Comp_mode
+  {
+    comp_off=0,
+    comp_lossless,
+    comp_lossy
+  };
+
+
+public:
+  /** コンストラクタ */
+  FieldCompressor() {}
+
+  /**　デストラクタ */
+  ~FieldCompressor() {}
+
+
+public:
+
+  // 圧縮する
+  static unsigned char* encode(const REAL_TYPE* src,
+                               const size_t n,
+                               const int stride,
+                               const int mode,
+                               const double tol,
+                               size_t& len);
+
+
+  // 展開する
+  static bool decode(const unsigned char* src,
+                     const size_t len,
+                     REAL_TYPE* dst,
+                     const size_t n);
+
+
+  /**
+   * @brief モード名
+   * @param [in] mode 圧縮モード
+   */
+  static const char* getModeName(const int mode)
+  {
+    switch (mode)
+    {
+      case comp_lossless: return "lossless";
+      case comp_lossy:    return "lossy";
+    }
+    return "off";
+  }
+
+
+private:
+
+  enum
+  {
+    header_size = 40,     ///< ヘッダのバイト数
+    block_cells = 16384   ///< ブロックあたりのセル数（要素数は成分数倍）
+  };
+
+  // 1ブロックの符号化
+  static size_t encodeBlock(const REAL_TYPE* src,
+                            const size_t m,
+                            const int stride,
+                            const int mode,
+                            const double tol,
+                            unsigned char* dst,
+                            unsigned char* wk);
+
+  // 1ブロックの復号
+  static bool decodeBlock(const unsigned char* src,
+                          const size_t len,
+                          const size_t m,
+                          const int stride,
+                          REAL_TYPE* dst,
+                          unsigned char* wk);
+
+  // 可逆符号化
+  static size_t packLossless(const REAL_TYPE* src,
+                             const size_t m,
+                             const int stride,
+                             unsigned char* dst,
+                             unsigned char* wk);
+
+  // 可逆符号の復号
+  static bool unpackLossless(const unsigned char* src,
+                             const size_t len,
+                             const size_t m,
+                             const int stride,
+                             REAL_TYPE* dst,
+                             unsigned char* wk);
+
+  // 量子化による符号化．誤差を保証できない場合0
+  static size_t packQuant(const REAL_TYPE* src,
+                          const size_t m,
+                          const int stride,
+                          const double tol,
+                          unsigned char* dst);
+
+  // 量子化符号の復号
+  static bool unpackQuant(const unsigned char* src,
+                          const size_t len,
+                          const size_t m,
+                          const int stride,
+                          REAL_TYPE* dst);
+
+  // ランレングス符号化
+  static size_t rleEncode(const unsigned char* src, const size_t n, unsigned char* dst);
+
+  // ランレングス符号の復号
+  static bool rleDecode(const unsigned char* src, const size_t len, unsigned char* dst, const size_t n);
+
+};
+
+#endif // _FFV_FIELD_COMPRESSOR_H_
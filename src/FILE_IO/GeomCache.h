@@ -0,0 +1,213 @@
+#ifndef _FFV_GEOM_CACHE_H_
+#define _FFV_GEOM_CACHE_H_
+
+//##################################################################################
+//
+// FFV-C : Frontflow / violet Cartesian
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   GeomCache.h
+ * @brief  GeomCache class Header
+ * @author aics
+ */
+
+// 形状前処理（交点計算，フィル，BCindexのエンコード）の結果をランクごとのファイルに保存し，
+// 次回以降の実行で再利用する
+//
+//   ファイル構成 : ヘッダ | コンポーネント表 | bcd | bcp | cdf | bid | cut
+//   ヘッダのkeyはSTLの内容，格子，領域分割，BCテーブルから作るハッシュ値で，
+//   一致しなければ使わない．ペイロードのチェックサムで破損も検出する
+
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include "Component.h"
+
+using namespace std;
+
+
+class GeomCache {
+
+public:
+  static const unsigned long long HashSeed = 14695981039346656037ULL; ///< FNV-1aの初期値
+
+  /// 前処理アルゴリズムの版　キーに含める
+  /// 交点計算，フィル，BCindexのエンコードの結果が変わる修正をしたら上げる（ファイル書式の版とは別）
+  static const unsigned int AlgoRevision = 1;
+
+  /** ヘッダ */
+  typedef struct
+  {
+    char magic[8];             ///< "FFVGEOC"
+    unsigned int version;      ///< 書式の版
+    unsigned int endian;       ///< バイト順の確認用 0x01020304
+    unsigned long long key;    ///< 入力条件のハッシュ値
+    unsigned long long nx;     ///< ガイドセルを含む要素数
+    unsigned long long sum;    ///< ペイロードのチェックサム
+    unsigned long long cell[6];///< L_Acell, G_Acell, L_Wcell, G_Wcell, L_Fcell, G_Fcell
+    int n_compo;               ///< コンポーネント数
+    int pad;
+  } Header;
+
+  /** コンポーネントごとの前処理結果 */
+  typedef struct
+  {
+    unsigned long long element; ///< 要素数
+    int st[3];                  ///< Bboxの始点
+    int ed[3];                  ///< Bboxの終点
+    int ens;                    ///< 存在フラグ
+    int pad;
+    double area;                ///< 断面積
+  } CompoRecord;
+
+private:
+  string fname;               ///< キャッシュファイル名
+  unsigned long long key;     ///< 入力条件のハッシュ値
+
+  void* map;                  ///< マップした領域
+  size_t map_size;            ///< マップした大きさ
+  bool hit;                   ///< キャッシュを使用した場合true
+
+
+public:
+  /** コンストラクタ */
+  GeomCache() {
+    key      = 0;
+    map      = NULL;
+    map_size = 0;
+    hit      = false;
+  }
+
+  /**　デストラクタ */
+  ~GeomCache() {
+    close();
+  }
+
+
+public:
+
+  /**
+   * @brief バイト列のハッシュ値（FNV-1a，8バイト単位）
+   * @param [in] p  先頭
+   * @param [in] n  バイト数
+   * @param [in] h  初期値（前回の値をつなげる）
+   */
+  static unsigned long long hashBytes(const void* p, const size_t n, unsigned long long h=HashSeed);
+
+
+  /**
+   * @brief 文字列のハッシュ値
+   * @param [in] s  文字列
+   * @param [in] h  初期値
+   */
+  static unsigned long long hashString(const string& s, unsigned long long h=HashSeed)
+  {
+    unsigned long long len = (unsigned long long)s.size();
+    h = hashBytes(&len, sizeof(len), h);
+    return hashBytes(s.c_str(), s.size(), h);
+  }
+
+
+  /**
+   * @brief ファイル内容のハッシュ値
+   * @param [in]     path ファイル名
+   * @param [in,out] h    ハッシュ値
+   * @retval 読めない場合false
+   */
+  static bool hashFile(const char* path, unsigned long long& h);
+
+
+  /**
+   * @brief キャッシュファイル名と入力条件のハッシュ値を設定
+   * @param [in] dir   ディレクトリ
+   * @param [in] rank  ランク番号
+   * @param [in] m_key ハッシュ値
+   */
+  void setKey(const string& dir, const int rank, const unsigned long long m_key);
+
+
+  /**
+   * @brief キャッシュファイルをマップして検証する
+   * @param [in] nx      ガイドセルを含む要素数
+   * @param [in] NoCompo コンポーネント数
+   * @retval 使える場合true（マップは保持する）
+   */
+  bool open(const size_t nx, const int NoCompo);
+
+
+  /**
+   * @brief マップした内容を配列へコピーする
+   * @param [out] bcd BCindex ID
+   * @param [out] bcp BCindex P
+   * @param [out] cdf BCindex C
+   * @param [out] bid 境界ID
+   * @param [out] cut 交点情報
+   */
+  void restoreArray(int* bcd, int* bcp, int* cdf, int* bid, long long* cut);
+
+
+  /**
+   * @brief マップした内容をコンポーネントとセル数へコピーし，マップを解放する
+   * @param [out] cmp     CompoList
+   * @param [in]  NoCompo コンポーネント数
+   * @param [out] cell    セル数 L_Acell, G_Acell, L_Wcell, G_Wcell, L_Fcell, G_Fcell
+   * @note BCindexのエンコードで決まる値なので，エンコードを行う位置で呼ぶ
+   */
+  void restoreCompo(CompoList* cmp, const int NoCompo, unsigned long* cell);
+
+
+  /** @brief マップを解放する */
+  void close();
+
+
+  /**
+   * @brief 前処理結果を書き出す
+   * @param [in] nx      ガイドセルを含む要素数
+   * @param [in] bcd     BCindex ID
+   * @param [in] bcp     BCindex P
+   * @param [in] cdf     BCindex C
+   * @param [in] bid     境界ID
+   * @param [in] cut     交点情報
+   * @param [in] cmp     CompoList
+   * @param [in] NoCompo コンポーネント数
+   * @param [in] cell    セル数
+   * @retval 書き出せない場合false
+   */
+  bool save(const size_t nx,
+            const int* bcd,
+            const int* bcp,
+            const int* cdf,
+            const int* bid,
+            const long long* cut,
+            CompoList* cmp,
+            const int NoCompo,
+            const unsigned long* cell);
+
+
+  /** @brief キャッシュを使用したかどうか */
+  bool isHit() const
+  {
+    return hit;
+  }
+
+
+  /** @brief キャッシュファイル名 */
+  string getFile() const
+  {
+    return fname;
+  }
+
+};
+
+#endif // _FFV_GEOM_CACHE_H_
@@ -0,0 +1,203 @@
+#ifndef _FFV_SHARED_FILE_H_
+#define _FFV_SHARED_FILE_H_
+
+//##################################################################################
+//
+// FFV-C : Frontflow / violet Cartesian
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   SharedFile.h
+ * @brief  SharedFile class Header
+ * @author aics
+ */
+
+// 1変数1ステップを全ランクで1つのファイルに書き出す（MPI-IOの集団入出力）
+//
+//   データファイル <prefix>_<step>.mpio : 全体領域の配列をnijkの並び（成分が最内）で格納する．
+//                                        ガイドセルは含まない．ヘッダなし
+//   インデクス     <prefix>_<step>.mpio.idx : ランク0が書くテキスト．全体サイズ，成分数，
+//                                        データ型，バイト順，時刻，最大最小値など
+//
+//   各ランクは自領域を部分配列のデータ型で読み書きするので，読み込み時の領域分割は
+//   書き出し時と異なってよい
+//
+//   圧縮した場合のデータファイル（インデクスのCompressionがoff以外）
+//     ヘッダ "FFVCZ01\0"(8byte), 書き出しランク数(int64)
+//     ランク毎の表 {head[3], size[3], オフセット, 符号長} (int64 x 8 x ランク数)
+//     ランク毎の自領域（nijk，ガイドセルなし）のFieldCompressorの符号列
+//   読み込み時は自領域と重なるランクの符号列を展開して切り出す
+
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include "mpi.h"
+#include "FB_Define.h"
+#include "FieldCompressor.h"
+
+using namespace std;
+
+
+class SharedFile {
+
+public:
+
+  /** インデクスの内容 */
+  typedef struct
+  {
+    string name;          ///< 変数名
+    string comp[3];       ///< 成分名
+    unsigned step;        ///< ステップ
+    double time;          ///< 時刻
+    int gsize[3];         ///< 全体の要素数
+    int gdiv[3];          ///< 書き出し時の領域分割数（参考）
+    int ncomp;            ///< 成分数
+    int dsize;            ///< 要素のバイト数
+    int little;           ///< リトルエンディアンなら1
+    double org[3];        ///< 全体領域の基点
+    double pit[3];        ///< 格子幅
+    int nminmax;          ///< 最大最小値の数
+    double minmax[8];     ///< 最大最小値
+    int avr;              ///< 平均値なら1
+    unsigned step_avr;    ///< 平均をとったステップ数
+    double time_avr;      ///< 平均をとった時間
+    int cmode;            ///< 圧縮モード FieldCompressor::Comp_mode
+    double tol;           ///< 非可逆圧縮の許容誤差（絶対値）
+    unsigned long long csize; ///< 圧縮後のファイルサイズ
+  } Index;
+
+
+  /** 圧縮ファイルの書き出しランク毎の表 */
+  typedef struct
+  {
+    long long head[3];    ///< 開始インデクス（1から）
+    long long size[3];    ///< サイズ
+    long long offset;     ///< 符号列の位置
+    long long length;     ///< 符号列のバイト数
+  } Block;
+
+
+public:
+  /** コンストラクタ */
+  SharedFile() {}
+
+  /**　デストラクタ */
+  ~SharedFile() {}
+
+
+public:
+
+  /**
+   * @brief インデクスの初期値
+   * @param [out] ix インデクス
+   */
+  static void initIndex(Index& ix);
+
+
+  /**
+   * @brief データファイル名
+   * @param [in] prefix パスを含むプレフィックス
+   * @param [in] step   ステップ
+   */
+  static string getDataFile(const string& prefix, const unsigned step);
+
+
+  /**
+   * @brief インデクスファイル名
+   * @param [in] prefix パスを含むプレフィックス
+   * @param [in] step   ステップ
+   */
+  static string getIndexFile(const string& prefix, const unsigned step)
+  {
+    return getDataFile(prefix, step) + ".idx";
+  }
+
+
+  // 自領域を共有ファイルに書き出す
+  static bool write(const string& fname,
+                    const REAL_TYPE* d,
+                    const int nc,
+                    const int* sz,
+                    const int gc,
+                    const int* head,
+                    const int* G_size,
+                    MPI_Comm comm);
+
+
+  // 共有ファイルから自領域を読み込む
+  static bool read(const string& fname,
+                   REAL_TYPE* d,
+                   const int nc,
+                   const int* sz,
+                   const int gc,
+                   const int* head,
+                   const int* G_size,
+                   MPI_Comm comm);
+
+
+  // 自領域を圧縮して共有ファイルに書き出す
+  static bool writeCompressed(const string& fname,
+                              const REAL_TYPE* d,
+                              const int nc,
+                              const int* sz,
+                              const int gc,
+                              const int* head,
+                              const int mode,
+                              const double tol,
+                              MPI_Comm comm,
+                              unsigned long long& csize);
+
+
+  // 圧縮した共有ファイルから自領域を読み込む
+  static bool readCompressed(const string& fname,
+                             REAL_TYPE* d,
+                             const int nc,
+                             const int* sz,
+                             const int gc,
+                             const int* head,
+                             const int* G_size,
+                             MPI_Comm comm);
+
+
+  // 圧縮ファイルの表を読み込み，全ランクに配る
+  static bool readTable(const string& fname, vector<Block>& tbl, MPI_Comm comm);
+
+
+  // インデクスを書き出す
+  static bool writeIndex(const string& fname, const Index& ix);
+
+
+  // インデクスを読み込み，全ランクに配る
+  static bool readIndex(const string& fname, Index& ix, MPI_Comm comm);
+
+
+private:
+
+  // メモリ側とファイル側の部分配列のデータ型を作る
+  static bool makeTypes(const int nc,
+                        const int* sz,
+                        const int gc,
+                        const int* head,
+                        const int* G_size,
+                        MPI_Datatype& mtype,
+                        MPI_Datatype& ftype);
+
+  // 集団入出力のヒント
+  static MPI_Info makeInfo();
+
+  // 全ランクで成否を揃える
+  static bool agree(bool ok, MPI_Comm comm);
+
+};
+
+#endif // _FFV_SHARED_FILE_H_
@@ -80,6 +80,7 @@ protected:
   
   string OutDirPath;   ///< 出力ディレクトリパス
   string InDirPath;    ///< 入力ディレクトリパス
+  string ScatterDir;   ///< ランクごとに分配したSTLの一時ディレクトリ
   string file_fmt_ext; ///< フォーマット識別子
   
   
@@ -92,15 +93,15 @@ protected:
   REAL_TYPE* d_ws;         ///< work for scalar
   REAL_TYPE* d_wv;         ///< work for vector
   REAL_TYPE* d_ap;         ///< averaged pressure
-  REAL_TYPE* d_av;         ///< averaged velocity
+  STORE_TYPE* d_av;        ///< averaged velocity
   REAL_TYPE* d_ae;         ///< averaged internal energy
   REAL_TYPE* d_dv;         ///< Divergence
-  REAL_TYPE* d_rms_v;      ///< velocity rms
-  REAL_TYPE* d_rms_mean_v; ///< velocity rms mean
-  REAL_TYPE* d_rms_p;      ///< pressure rms
-  REAL_TYPE* d_rms_mean_p; ///< pressure rms mean
-  REAL_TYPE* d_rms_t;      ///< temperature rms
-  REAL_TYPE* d_rms_mean_t; ///< temperature rms mean
+  STORE_TYPE* d_rms_v;      ///< velocity rms
+  STORE_TYPE* d_rms_mean_v; ///< velocity rms mean
+  STORE_TYPE* d_rms_p;      ///< pressure rms
+  STORE_TYPE* d_rms_mean_p; ///< pressure rms mean
+  STORE_TYPE* d_rms_t;      ///< temperature rms
+  STORE_TYPE* d_rms_mean_t; ///< temperature rms mean
   int* d_bcd;              ///< BCindex D
   int* d_cdf;              ///< BCindex C
   double* mat_tbl;         ///< material table
@@ -296,6 +297,32 @@ public:
   }
   
   
+  /**
+   * @brief 基本変数の非同期出力を開始する
+   * @param [in,out] total 使用メモリ量
+   * @retval 非同期出力を開始した場合true
+   * @note 全ランクで呼ぶこと
+   */
+  virtual bool startAsyncOutput(double& total) {
+    return false;
+  }
+  
+  
+  /**
+   * @brief 投入済みの非同期出力の完了を待つ
+   */
+  virtual void flushAsyncOutput() {
+  }
+  
+  
+  /**
+   * @brief 非同期出力を終了する
+   * @note MPI_Finalize()の前に呼ぶこと
+   */
+  virtual void stopAsyncOutput() {
+  }
+  
+  
   // 制御パラメータSTEERの表示
   void printSteerConditions(FILE* fp);
   
@@ -368,15 +395,15 @@ public:
                       REAL_TYPE* m_d_ws,
                       REAL_TYPE* m_d_wv,
                       REAL_TYPE* m_d_ap,
-                      REAL_TYPE* m_d_av,
+                      STORE_TYPE* m_d_av,
                       REAL_TYPE* m_d_ae,
                       REAL_TYPE* m_d_dv,
-                      REAL_TYPE* m_d_rms_v,
-                      REAL_TYPE* m_d_rms_mean_v,
-                      REAL_TYPE* m_d_rms_p,
-                      REAL_TYPE* m_d_rms_mean_p,
-                      REAL_TYPE* m_d_rms_t,
-                      REAL_TYPE* m_d_rms_mean_t,
+                      STORE_TYPE* m_d_rms_v,
+                      STORE_TYPE* m_d_rms_mean_v,
+                      STORE_TYPE* m_d_rms_p,
+                      STORE_TYPE* m_d_rms_mean_p,
+                      STORE_TYPE* m_d_rms_t,
+                      STORE_TYPE* m_d_rms_mean_t,
                       int* m_d_bcd,
                       int* m_d_cdf,
                       double* m_mat_tbl,
@@ -410,7 +437,52 @@ public:
   
   
   // polylibファイルをテンポラリに出力
-  bool writePolylibFile(CompoList* cmp);
+  bool writePolylibFile(CompoList* cmp, const int rank=-1);
+  
+  
+  // 分配したSTLの一時ディレクトリを作る
+  bool makeScatterDir();
+  
+  
+  // 分配したSTLの一時ディレクトリを消す
+  void removeScatterDir();
+  
+  
+  /** @brief 分配したSTLの一時ディレクトリ */
+  const string& getScatterDir() const
+  {
+    return ScatterDir;
+  }
+  
+  
+  /**
+   * @brief polylibファイル名
+   * @param [in] rank ランク番号（負値は全体の設定ファイル）
+   * @param [in] dir  ランクごとの設定ファイルを置くディレクトリ
+   */
+  static string getPolylibFile(const int rank=-1, const string& dir="")
+  {
+    if ( rank < 0 ) return "polylib.tp";
+    
+    char tmp[32];
+    sprintf(tmp, "polylib_%06d.tp", rank);
+    return dir.empty() ? string(tmp) : dir + "/" + string(tmp);
+  }
+  
+  
+  /**
+   * @brief ランクごとに分配したSTLのファイル名
+   * @param [in] alias ポリゴングループ名
+   * @param [in] rank  ランク番号
+   * @param [in] dir   置き場所のディレクトリ
+   */
+  static string getScatteredSTL(const string& alias, const int rank, const string& dir="")
+  {
+    char tmp[32];
+    sprintf(tmp, "_%06d.stl", rank);
+    const string fname = "scatter_" + alias + string(tmp);
+    return dir.empty() ? fname : dir + "/" + fname;
+  }
   
   
   /**
@@ -465,13 +537,13 @@ public:
    * @param [in]     g                 ガイドセル長 (時間平均値)            
    * @param [in,out] flop              浮動小数点演算数
    */
-  virtual void OutputMean(REAL_TYPE*        d_av,        
-                          REAL_TYPE*        d_rms_mean_v,        
-                          REAL_TYPE*        d_aR,        
-                          REAL_TYPE*        d_aP,        
-                          REAL_TYPE*        d_aE,        
-                          REAL_TYPE*        d_aT,        
-                          REAL_TYPE*        d_aPI,        
+  virtual void OutputMean(STORE_TYPE*       d_av,        
+                          STORE_TYPE*       d_rms_mean_v,        
+                          STORE_TYPE*       d_aR,        
+                          STORE_TYPE*       d_aP,        
+                          STORE_TYPE*       d_aE,        
+                          STORE_TYPE*       d_aT,        
+                          STORE_TYPE*       d_aPI,        
                           int               myRank,
                           int*              sz,
                           unsigned long int CurrentStepStat,
@@ -25,6 +25,9 @@
 
 
 #include "ffv_io_base.h"
+#include "AsyncWriter.h"
+#include "SharedFile.h"
+#include "Alloc.h"
 
 
 class SPH : public IO_BASE {
@@ -78,6 +81,20 @@ private:
   cdm_DFI *DFI_OUT_HLT;     ///< Helicity
   cdm_DFI *DFI_OUT_DIV;     ///< Divergence for debug
   
+  // 非同期出力
+  int AsyncWrite;           ///< 非同期出力 (ON/OFF)
+  int AsyncDepth;           ///< 退避領域の数
+  AsyncWriter AW;           ///< 出力スレッド
+  MPI_Comm io_comm;         ///< 出力スレッドの集約に使うコミュニケータ
+  REAL_TYPE* a_ws;          ///< 出力スレッドのスカラー作業配列
+  REAL_TYPE* a_wv;          ///< 出力スレッドのベクトル作業配列
+  REAL_TYPE* a_iobuf;       ///< 出力スレッドのベクトル作業配列
+  
+  // 共有ファイルの圧縮
+  int Compress;             ///< 圧縮モード FieldCompressor::Comp_mode
+  double CompTol;           ///< 非可逆圧縮の許容誤差
+  int CompRelTol;           ///< 許容誤差を変数の値の幅に対する比で与える (ON/OFF)
+  
   
 public:
   
@@ -103,6 +120,17 @@ public:
     DFI_OUT_HLT  = NULL;
     DFI_OUT_DIV  = NULL;
     
+    AsyncWrite = OFF;
+    AsyncDepth = 2;
+    io_comm    = MPI_COMM_NULL;
+    a_ws       = NULL;
+    a_wv       = NULL;
+    a_iobuf    = NULL;
+    
+    Compress   = FieldCompressor::comp_off;
+    CompTol    = 0.0;
+    CompRelTol = OFF;
+    
     // ファイル名
     f_Pressure       = "prs";
     f_Velocity       = "vel";
@@ -119,6 +147,7 @@ public:
   }
   
   ~SPH() {
+    stopAsyncOutput();
     if( DFI_IN_PRS    != NULL ) delete DFI_IN_PRS;
     if( DFI_IN_VEL    != NULL ) delete DFI_IN_VEL;
     if( DFI_IN_FVEL   != NULL ) delete DFI_IN_FVEL;
@@ -155,6 +184,80 @@ private:
                                     double& flop);
   
   
+  // 固有オプションをロード
+  virtual void getInherentOption();
+  
+  
+  // 固有の制御パラメータSTEERの表示
+  virtual void printSteerConditionsInherent(FILE* fp);
+  
+  
+  // 基本変数を単位変換して出力する
+  void writeBasicVariables(const unsigned m_CurrentStep,
+                           const double m_CurrentTime,
+                           REAL_TYPE* m_p,
+                           REAL_TYPE* m_v,
+                           REAL_TYPE* m_vf,
+                           REAL_TYPE* m_ie,
+                           REAL_TYPE* m_dv,
+                           REAL_TYPE* m_v00,
+                           REAL_TYPE* m_ws,
+                           REAL_TYPE* m_wv,
+                           REAL_TYPE* m_iobuf,
+                           MPI_Comm comm,
+                           double& flop);
+  
+  
+  // 出力スレッドから呼ばれる出力関数
+  static void writeSlot(void* owner, AsyncWriter::Slot* s);
+  
+  
+  // 退避領域内の各変数の先頭を返す
+  int setSlotPointers(REAL_TYPE* buf,
+                      REAL_TYPE*& m_p,
+                      REAL_TYPE*& m_v,
+                      REAL_TYPE*& m_vf,
+                      REAL_TYPE*& m_ie,
+                      REAL_TYPE*& m_dv);
+  
+  
+  // 最大値と最小値のランク間集約
+  bool reduceMinMax(REAL_TYPE* f_min, REAL_TYPE* f_max, const int n, MPI_Comm comm);
+  
+  
+  // 1変数の出力
+  void writeField(cdm_DFI* dfi,
+                  const string& prefix,
+                  const int nc,
+                  const char* n0,
+                  const char* n1,
+                  const char* n2,
+                  const unsigned m_step,
+                  const double m_time,
+                  REAL_TYPE* d,
+                  REAL_TYPE* minmax,
+                  const bool avr_skip,
+                  const unsigned stepAvr,
+                  const double timeAvr,
+                  MPI_Comm comm);
+  
+  
+  // 1変数の読み込み
+  bool readField(cdm_DFI* dfi,
+                 const string& prefix,
+                 const int nc,
+                 const unsigned m_step,
+                 REAL_TYPE* d,
+                 double& r_time,
+                 const bool inst,
+                 unsigned& step_avr,
+                 double& time_avr);
+  
+  
+  // 共有ファイルの入力プレフィックス
+  string getSharedPrefix(const string& str);
+  
+  
 public:
   
   // リスタートに必要なDFIファイルを取得
@@ -195,6 +298,18 @@ public:
                                     double& flop);
   
   
+  // 非同期出力を開始する
+  virtual bool startAsyncOutput(double& total);
+  
+  
+  // 投入済みの非同期出力の完了を待つ
+  virtual void flushAsyncOutput();
+  
+  
+  // 非同期出力を終了する
+  virtual void stopAsyncOutput();
+  
+  
   
   /**
    * @brief リスタートプロセス
@@ -240,13 +355,13 @@ public:
    * @param [in]     g                 ガイドセル長 (時間平均値)            
    * @param [in,out] flop              浮動小数点演算数
    */
-  virtual void OutputMean(REAL_TYPE*         d_av,
-                          REAL_TYPE*         d_rms_mean_v,
-                          REAL_TYPE*         d_aR,
-                          REAL_TYPE*         d_aP,
-                          REAL_TYPE*         d_aE,
-                          REAL_TYPE*         d_aT,
-                          REAL_TYPE*         d_aPI,
+  virtual void OutputMean(STORE_TYPE*        d_av,
+                          STORE_TYPE*        d_rms_mean_v,
+                          STORE_TYPE*        d_aR,
+                          STORE_TYPE*        d_aP,
+                          STORE_TYPE*        d_aE,
+                          STORE_TYPE*        d_aT,
+                          STORE_TYPE*        d_aPI,
                           int                myRank,
                           int*               sz,
                           unsigned long int  CurrentStepStat,
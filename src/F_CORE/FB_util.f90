@@ -19,6 +19,8 @@
 !! @author aics
 !<
 
+#include "ffv_f_store.h"
+
 !> ********************************************************************
 !! @brief 粗い格子から密な格子への補間（ゼロ次）
 !! @param [out] dst 密な格子系
@@ -935,14 +937,16 @@ end subroutine fb_vin_ijkn
 !! @param [in]     v    ベクトル値
 !! @param [in]     nadd 加算回数
 !! @param [i,out]  flop 浮動小数演算数
+!! @note 逐次平均 avr_n = avr_{n-1} + (v - avr_{n-1})/n で更新し，加算回数が大きくなっても桁落ちしない
 !<
   subroutine fb_average_v (avr, sz, g, v, nadd, flop)
   implicit none
   integer                                                   ::  i, j, k, ix, jx, kx, g
   integer, dimension(3)                                     ::  sz
   double precision                                          ::  flop
-  real                                                      ::  nadd, val1, val2
-  real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  v, avr
+  real                                                      ::  nadd, val2
+  real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  v
+  real(STORE_KIND), dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  avr
 
   ix = sz(1)
   jx = sz(2)
@@ -951,19 +955,18 @@ end subroutine fb_vin_ijkn
   flop = flop + dble(ix)*dble(jx)*dble(kx)*9.0d0 + 9.0d0
 
   val2 = 1.0/nadd
-  val1 = 1.0 - val2
 
 !$OMP PARALLEL &
-!$OMP FIRSTPRIVATE(ix, jx, kx, val1, val2)
+!$OMP FIRSTPRIVATE(ix, jx, kx, val2)
 
 !$OMP DO SCHEDULE(static)
 
   do k=1,kx
   do j=1,jx
   do i=1,ix
-    avr(i,j,k,1) = val1 * avr(i,j,k,1) + val2 * v(i,j,k,1)
-    avr(i,j,k,2) = val1 * avr(i,j,k,2) + val2 * v(i,j,k,2)
-    avr(i,j,k,3) = val1 * avr(i,j,k,3) + val2 * v(i,j,k,3)
+    avr(i,j,k,1) = avr(i,j,k,1) + val2 * ( v(i,j,k,1) - avr(i,j,k,1) )
+    avr(i,j,k,2) = avr(i,j,k,2) + val2 * ( v(i,j,k,2) - avr(i,j,k,2) )
+    avr(i,j,k,3) = avr(i,j,k,3) + val2 * ( v(i,j,k,3) - avr(i,j,k,3) )
   end do
   end do
   end do
@@ -983,13 +986,14 @@ end subroutine fb_vin_ijkn
 !! @param [in]     s    スカラ値
 !! @param [in]     nadd 加算回数
 !! @param [in,out] flop 浮動小数演算数
+!! @note 逐次平均 avr_n = avr_{n-1} + (s - avr_{n-1})/n
 !<
   subroutine fb_average_s (avr, sz, g, s, nadd, flop)
   implicit none
   integer                                                   ::  i, j, k, ix, jx, kx, g
   integer, dimension(3)                                     ::  sz
   double precision                                          ::  flop
-  real                                                      ::  nadd, val1, val2
+  real                                                      ::  nadd, val2
   real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g)    ::  s, avr
 
   ix = sz(1)
@@ -999,7 +1003,6 @@ end subroutine fb_vin_ijkn
   flop = flop + dble(ix)*dble(jx)*dble(kx)*3.0d0 + 9.0d0
 
   val2 = 1.0/nadd
-  val1 = 1.0 - val2
 
 !$OMP PARALLEL &
 !$OMP FIRSTPRIVATE(ix, jx, kx)
@@ -1009,7 +1012,7 @@ end subroutine fb_vin_ijkn
   do k=1,kx
   do j=1,jx
   do i=1,ix
-    avr(i,j,k) = val1 * avr(i,j,k) + val2 * s(i,j,k)
+    avr(i,j,k) = avr(i,j,k) + val2 * ( s(i,j,k) - avr(i,j,k) )
   end do
   end do
   end do
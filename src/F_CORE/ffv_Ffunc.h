@@ -97,15 +97,12 @@
 #define i2vgt_              I2VGT
 #define rot_v_              ROT_V
 #define find_vmax_          FIND_VMAX
+#define step_diagnostics_   STEP_DIAGNOSTICS
 #define force_compo_        FORCE_COMPO
 #define calc_rms_v_         CALC_RMS_V
 #define calc_rms_s_         CALC_RMS_S
 #define output_vtk_         OUTPUT_VTK
-#define calc_reynolds_stress_     CALC_REYNOLDS_STRESS
-#define calc_production_rate_     CALC_PRODUCTION_RATE
-#define calc_dissipation_rate_    CALC_DISSIPATION_RATE
-#define calc_turb_transport_rate_ CALC_TURB_TRANSPORT_RATE
-#define calc_vel_pregrad_term_    CALC_VEL_PREGRAD_TERM
+#define calc_turb_budget_         CALC_TURB_BUDGET
 #define averaging_xz_plane_       AVERAGING_XZ_PLANE
 #define perturbu_           PERTURBU
 #define generate_iblank_    GENERATE_IBLANK
@@ -156,7 +153,7 @@
 extern "C" {
   //***********************************************************************************************
   // ffv_forcing.f90
-  void hex_dir_(REAL_TYPE* v, int* sz, int* g, int* st, int* ed, int* bd, REAL_TYPE* vf, int* odr, REAL_TYPE* v00, REAL_TYPE* nv, double* flop);
+  void hex_dir_(REAL_TYPE* v, int* sz, int* g, int* st, int* ed, int* bd, STORE_TYPE* vf, int* odr, REAL_TYPE* v00, REAL_TYPE* nv, double* flop);
   void force_keep_vec_(REAL_TYPE* wk, int* c_sz, int* st, int* ed, REAL_TYPE* v, int* sz, int* g);
   
   void hex_psrc_ (REAL_TYPE* src,
@@ -165,7 +162,7 @@ extern "C" {
                   int* st,
                   int* ed,
                   int* bd,
-                  REAL_TYPE* vf,
+                  STORE_TYPE* vf,
                   REAL_TYPE* wk,
                   int* c_sz,
                   int* odr,
@@ -180,7 +177,7 @@ extern "C" {
                         int* st,
                         int* ed,
                         int* bd,
-                        REAL_TYPE* vf,
+                        STORE_TYPE* vf,
                         REAL_TYPE* v,
                         int* odr,
                         REAL_TYPE* v00,
@@ -196,7 +193,7 @@ extern "C" {
                        int* st,
                        int* ed,
                        int* bd,
-                       REAL_TYPE* vf,
+                       STORE_TYPE* vf,
                        REAL_TYPE* wk,
                        int* c_sz,
                        int* odr,
@@ -240,6 +237,8 @@ extern "C" {
   void ps_buoyancy_ (REAL_TYPE* v,
                      int* sz,
                      int* g,
+                     int* st,
+                     int* ed,
                      REAL_TYPE* dgr,
                      REAL_TYPE* ie,
                      int* bd,
@@ -526,7 +525,7 @@ extern "C" {
   
   //***********************************************************************************************
   // ffv_velocity_binary.f90
-  void ab2_               (REAL_TYPE* vc, int* sz, int* g, REAL_TYPE* dt, REAL_TYPE* v, REAL_TYPE* ab, int* bd, REAL_TYPE* v00, double* flop);
+  void ab2_               (REAL_TYPE* vc, int* sz, int* g, int* st, int* ed, REAL_TYPE* dt, REAL_TYPE* v, REAL_TYPE* ab, int* bd, REAL_TYPE* v00, double* flop);
   
   void divergence_cc_ (REAL_TYPE* dv,
                        int* sz,
@@ -537,7 +536,7 @@ extern "C" {
                        int* bid,
                        double* flop);
   
-  void eddy_viscosity_    (REAL_TYPE* vt,
+  void eddy_viscosity_    (STORE_TYPE* vt,
                            int* sz,
                            int* g,
                            REAL_TYPE* dh,
@@ -552,6 +551,8 @@ extern "C" {
   void euler_explicit_    (REAL_TYPE* vc,
                            int* sz,
                            int* g,
+                           int* st,
+                           int* ed,
                            REAL_TYPE* dt,
                            REAL_TYPE* v,
                            int* bd,
@@ -560,6 +561,8 @@ extern "C" {
   void pvec_muscl_        (REAL_TYPE* wv,
                            int* sz,
                            int* g,
+                           int* st,
+                           int* ed,
                            REAL_TYPE* dh,
                            int* c_scheme,
                            REAL_TYPE* v00,
@@ -574,6 +577,8 @@ extern "C" {
   void pvec_central_      (REAL_TYPE* wv,
                            int* sz,
                            int* g,
+                           int* st,
+                           int* ed,
                            REAL_TYPE* dh,
                            int* c_scheme,
                            REAL_TYPE* v00,
@@ -590,6 +595,8 @@ extern "C" {
                     REAL_TYPE* div,
                     int* sz,
                     int* g,
+                    int* st,
+                    int* ed,
                     REAL_TYPE* dt,
                     REAL_TYPE* dh,
                     REAL_TYPE* vc,
@@ -693,21 +700,37 @@ extern "C" {
                double* flop);
   
   void find_vmax_         (REAL_TYPE* v_max, int* sz, int* g, REAL_TYPE* v00, REAL_TYPE* v, double* flop);
+  
+  void step_diagnostics_  (REAL_TYPE* v_max,
+                           double* d,
+                           int* sz,
+                           int* g,
+                           REAL_TYPE* v00,
+                           REAL_TYPE* v,
+                           REAL_TYPE* v0,
+                           REAL_TYPE* p,
+                           REAL_TYPE* p0,
+                           REAL_TYPE* ie,
+                           REAL_TYPE* ie0,
+                           int* bx,
+                           int* heat,
+                           double* flop);
+  
   void face_avr_sampling_ (REAL_TYPE* p, int* sz, int* g, int* face, REAL_TYPE* avr);
   void shift_pressure_    (REAL_TYPE* p, int* sz, int* g, REAL_TYPE* avr);
   void force_compo_       (REAL_TYPE* frc, int* sz, int* g, int* tgt, REAL_TYPE* p, int* bid, REAL_TYPE* dh, int* st, int* ed, double* flop);
 
-  void calc_rms_v_ (REAL_TYPE* rms,
-                    REAL_TYPE* rmsmean,
+  void calc_rms_v_ (STORE_TYPE* rms,
+                    STORE_TYPE* rmsmean,
                     int* sz,
                     int* g,
                     REAL_TYPE* v,
-                    REAL_TYPE* av,
+                    STORE_TYPE* av,
                     REAL_TYPE* accum,
                     double* flop);
   
-  void calc_rms_s_ (REAL_TYPE* rms,
-                    REAL_TYPE* rmsmean,
+  void calc_rms_s_ (STORE_TYPE* rms,
+                    STORE_TYPE* rmsmean,
                     int* sz,
                     int* g,
                     REAL_TYPE* s,
@@ -729,58 +752,22 @@ extern "C" {
                    REAL_TYPE* p
                    );
 
-  void calc_reynolds_stress_ (REAL_TYPE* R,
-                              REAL_TYPE* R_ave,
-                              int* sz,
-                              int* g,
-                              REAL_TYPE* v,
-                              REAL_TYPE* v_ave,
-                              REAL_TYPE* nadd,
-                              double* flop);
-
-  void calc_production_rate_ (REAL_TYPE* P_ave,
-                              int* sz,
-                              REAL_TYPE* dh,
-                              int* g,
-                              REAL_TYPE* v_ave,
-                              REAL_TYPE* R,
-                              int* bv,
-                              REAL_TYPE* nadd,
-                              double* flop);
-
-  void calc_dissipation_rate_ (REAL_TYPE* E_ave,
-                              int* sz,
-                              REAL_TYPE* dh,
-                              int* g,
-                              REAL_TYPE* nu,
-                              REAL_TYPE* v,
-                              REAL_TYPE* v_ave,
-                              int* bv,
-                              REAL_TYPE* nadd,
-                              double* flop);
-
-  void calc_turb_transport_rate_ (REAL_TYPE* T_ave,
-                                  int* sz,
-                                  REAL_TYPE* dh,
-                                  int* g,
-                                  REAL_TYPE* v,
-                                  REAL_TYPE* v_ave,
-                                  REAL_TYPE* R,
-                                  int* bv,
-                                  REAL_TYPE* nadd,
-                                  double* flop);
-
-  void calc_vel_pregrad_term_ (REAL_TYPE* PI_ave,
-                               int* sz,
-                               REAL_TYPE* dh,
-                               int* g,
-                               REAL_TYPE* v,
-                               REAL_TYPE* v_ave,
-                               REAL_TYPE* p,
-                               REAL_TYPE* p_ave,
-                               int* bp,
-                               REAL_TYPE* nadd,
-                               double* flop);
+  void calc_turb_budget_ (STORE_TYPE* R_ave,
+                          STORE_TYPE* P_ave,
+                          STORE_TYPE* E_ave,
+                          STORE_TYPE* T_ave,
+                          STORE_TYPE* PI_ave,
+                          int* sz,
+                          REAL_TYPE* dh,
+                          int* g,
+                          REAL_TYPE* nu,
+                          REAL_TYPE* v,
+                          STORE_TYPE* v_ave,
+                          REAL_TYPE* p,
+                          REAL_TYPE* ap,
+                          int* bv,
+                          REAL_TYPE* nadd,
+                          double* flop);
 
   void averaging_xz_plane_ (REAL_TYPE* vmean,
                             REAL_TYPE* rmsmean,
@@ -791,13 +778,13 @@ extern "C" {
                             REAL_TYPE* PImean,
                             int*       sz,
                             int*       g,
-                            REAL_TYPE* v_ave,
-                            REAL_TYPE* rms_ave,
-                            REAL_TYPE* R_ave,
-                            REAL_TYPE* P_ave,
-                            REAL_TYPE* E_ave,
-                            REAL_TYPE* T_ave,
-                            REAL_TYPE* PI_ave
+                            STORE_TYPE* v_ave,
+                            STORE_TYPE* rms_ave,
+                            STORE_TYPE* R_ave,
+                            STORE_TYPE* P_ave,
+                            STORE_TYPE* E_ave,
+                            STORE_TYPE* T_ave,
+                            STORE_TYPE* PI_ave
                             );
 
   void src_trnc_ (REAL_TYPE* rhs,
@@ -922,7 +909,7 @@ extern "C" {
                            REAL_TYPE* nadd,
                            double* flop);
   
-  void fb_average_v_      (REAL_TYPE* avr,
+  void fb_average_v_      (STORE_TYPE* avr,
                            int* sz,
                            int* g,
                            REAL_TYPE* v,
@@ -0,0 +1,28 @@
+!###################################################################################
+!
+! FFV-C
+! Frontflow / violet Cartesian
+!
+!
+! Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+! All rights reserved.
+!
+! Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+! All rights reserved.
+!
+! Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+! All rights reserved.
+!
+!###################################################################################
+
+!> @file   ffv_f_store.h
+!! @brief  格納型の種別パラメータ
+!! @note   C++側のSTORE_TYPEに対応．プリプロセッサで展開する
+!!         -D_STORE_IS_FLOAT_ 指定時は単精度で格納し，演算は既定の実数型で行う
+!<
+
+#ifdef _STORE_IS_FLOAT_
+#define STORE_KIND selected_real_kind(6)
+#else
+#define STORE_KIND kind(1.0)
+#endif
@@ -360,6 +360,8 @@ end subroutine ps_muscl
 !! @param [in,out] v     速度ベクトル
 !! @param [in]     sz    配列長
 !! @param [in]     g     ガイドセル長
+!! @param [in]     st    ループの開始インデクス
+!! @param [in]     ed    ループの終了インデクス
 !! @param [in]     dgr   係数
 !! @param [in]     ie    内部エネルギー
 !! @param [in]     bd    BCindex B
@@ -368,11 +370,11 @@ end subroutine ps_muscl
 !! @param [in,out] flop  浮動小数点演算数
 !! @todo 対象セルは流体だけでよい？　active flag?
 !<
-    subroutine ps_buoyancy (v, sz, g, dgr, ie, bd, ncompo, mtbl, flop)
+    subroutine ps_buoyancy (v, sz, g, st, ed, dgr, ie, bd, ncompo, mtbl, flop)
     implicit none
     include '../FB/ffv_f_params.h'
     integer                                                   ::  i, j, k, ix, jx, kx, g, ncompo, l, idx
-    integer, dimension(3)                                     ::  sz
+    integer, dimension(3)                                     ::  sz, st, ed
     double precision                                          ::  flop
     real                                                      ::  dgr, r, rcp, t
     real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  v
@@ -385,16 +387,16 @@ end subroutine ps_muscl
     kx = sz(3)
     r = dgr
     
-    flop = flop + dble(ix)*dble(jx)*dble(kx)*12.0d0
+    flop = flop + dble(ed(1)-st(1)+1)*dble(ed(2)-st(2)+1)*dble(ed(3)-st(3)+1)*12.0d0
 
 !$OMP PARALLEL &
 !$OMP FIRSTPRIVATE(ix, jx, kx, r) &
 !$OMP PRIVATE(idx, l, rcp, t)
 
 !$OMP DO SCHEDULE(static)
-    do k=1,kx
-    do j=1,jx
-    do i=1,ix
+    do k=st(3),ed(3)
+    do j=st(2),ed(2)
+    do i=st(1),ed(1)
       idx = bd(i,j,k)
       l = ibits(idx, 0, bitw_5)
       rcp = mtbl(1, l) * mtbl(2, l)
@@ -20,6 +20,8 @@
 !! @author aics
 !<
 
+#include "ffv_f_store.h"
+
 !> ********************************************************************
 !! @brief 有効セルに対する発散の自乗和を計算
 !! @param [out] ds   残差の自乗和
@@ -168,6 +170,123 @@
     end subroutine find_vmax
 
 
+!> ********************************************************************
+!! @brief 1ステップ毎の監視量を1回のスイープで計算する
+!! @param [out] v_max 速度成分の最大値
+!! @param [out] d     変化量 (1)速度変化量の絶対値の和 (2)圧力変化量の2乗和 (3)圧力の和
+!!                    (4)温度変化量の2乗和 (5)温度の和
+!! @param [in]  sz    配列長
+!! @param [in]  g     ガイドセル長
+!! @param [in]  v00   参照速度
+!! @param [in]  v     速度ベクトル n+1 step
+!! @param [in]  v0    速度ベクトル n step
+!! @param [in]  p     圧力 n+1 step
+!! @param [in]  p0    圧力 n step
+!! @param [in]  ie    内部エネルギー n+1 step
+!! @param [in]  ie0   内部エネルギー n step
+!! @param [in]  bx    BCindex C
+!! @param [in]  heat  熱問題のとき1
+!! @param [out] flop  flop count
+!! @note find_vmax, fb_delta_v, fb_delta_s(圧力，温度)を融合したもの
+!<
+    subroutine step_diagnostics (v_max, d, sz, g, v00, v, v0, p, p0, ie, ie0, bx, heat, flop)
+    implicit none
+    include 'ffv_f_params.h'
+    integer                                                   ::  i, j, k, ix, jx, kx, g, heat
+    integer, dimension(3)                                     ::  sz
+    double precision                                          ::  flop
+    real                                                      ::  vm1, vm2, vm3, v_max, vx, vy, vz
+    double precision                                          ::  actv, x, y, z, s, a
+    double precision                                          ::  rv, rp, ap, rt, at
+    real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  v, v0
+    real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g)    ::  p, p0, ie, ie0
+    integer, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  bx
+    real, dimension(0:3)                                      ::  v00
+    double precision, dimension(5)                            ::  d
+
+    ix = sz(1)
+    jx = sz(2)
+    kx = sz(3)
+    vm1 = 0.0
+    vm2 = 0.0
+    vm3 = 0.0
+    vx = v00(1)
+    vy = v00(2)
+    vz = v00(3)
+    rv = 0.0
+    rp = 0.0
+    ap = 0.0
+    rt = 0.0
+    at = 0.0
+
+    ! vmax 9, velocity 28, pressure 7, temperature 7 >> sqrt double->20
+    if ( heat == 1 ) then
+      flop = flop + dble(ix)*dble(jx)*dble(kx)*51.0d0 + 2.0d0
+    else
+      flop = flop + dble(ix)*dble(jx)*dble(kx)*44.0d0 + 2.0d0
+    endif
+
+!$OMP PARALLEL &
+!$OMP REDUCTION(max:vm1) &
+!$OMP REDUCTION(max:vm2) &
+!$OMP REDUCTION(max:vm3) &
+!$OMP REDUCTION(+:rv) &
+!$OMP REDUCTION(+:rp) &
+!$OMP REDUCTION(+:ap) &
+!$OMP REDUCTION(+:rt) &
+!$OMP REDUCTION(+:at) &
+!$OMP PRIVATE(actv, x, y, z, s, a) &
+!$OMP FIRSTPRIVATE(ix, jx, kx, vx, vy, vz, heat)
+
+!$OMP DO SCHEDULE(static) COLLAPSE(2)
+
+    do k=1,kx
+    do j=1,jx
+    do i=1,ix
+      actv = dble(ibits(bx(i,j,k), State, 1))
+
+      ! 速度成分の最大値
+      vm1 = max(vm1, abs(v(i,j,k,1)-vx ) )
+      vm2 = max(vm2, abs(v(i,j,k,2)-vy ) )
+      vm3 = max(vm3, abs(v(i,j,k,3)-vz ) )
+
+      ! 速度の変化量
+      x = dble(v(i,j,k,1)) - dble(v0(i,j,k,1))
+      y = dble(v(i,j,k,2)) - dble(v0(i,j,k,2))
+      z = dble(v(i,j,k,3)) - dble(v0(i,j,k,3))
+      rv = rv + sqrt(x*x + y*y + z*z)*actv
+
+      ! 圧力の変化量と和
+      s = dble(p(i,j,k))
+      ap = ap + s * actv
+      a = ( s - dble(p0(i,j,k)) )*actv
+      rp = rp + a*a
+
+      ! 温度の変化量と和
+      if ( heat == 1 ) then
+        s = dble(ie(i,j,k))
+        at = at + s * actv
+        a = ( s - dble(ie0(i,j,k)) )*actv
+        rt = rt + a*a
+      endif
+    end do
+    end do
+    end do
+!$OMP END DO
+!$OMP END PARALLEL
+
+    v_max = max(vm1, vm2, vm3)
+
+    d(1) = rv
+    d(2) = rp
+    d(3) = ap
+    d(4) = rt
+    d(5) = at
+
+    return
+    end subroutine step_diagnostics
+
+
 !> ********************************************************************
 !! @brief 速度勾配テンソルの第２不変量の計算
 !! @param [out] q    速度勾配テンソルの第２不変量
@@ -923,7 +1042,7 @@
 !> ********************************************************************
 !! @brief 乱流の統計情報
 !! @param [out]    rms     瞬間の変動速度
-!! @param [in,out] rmsmean 変動速度の二乗和の平方根（実効値）
+!! @param [in,out] rmsmean 変動速度の絶対値の時間平均
 !! @param [in]     sz      配列長
 !! @param [in]     g       ガイドセル長
 !! @param [in]     v       速度
@@ -936,6 +1055,9 @@
 !!  u^{\prime} ; 変動値 = u - \var{u}
 !!  \sigma     ; 標準偏差 RMS, \sigma = \sqrt{ \var{ {u^{\prime}}^2 } }
 !! Turbulent Intensity = \frac{\sigma}{\var{U}}
+!!
+!! rmsmeanは |u^{\prime}| の時間平均として保持する（統計リスタートファイルと同じ意味）．
+!! 更新は \var{x}_n = \var{x}_{n-1} + ( x - \var{x}_{n-1} ) / n の逐次形で行う
 !<
 subroutine calc_rms_v(rms, rmsmean, sz, g, v, av, accum, flop)
 implicit none
@@ -943,21 +1065,21 @@ include 'ffv_f_params.h'
 integer                                                   :: ix, jx, kx, i, j, k, g
 double precision                                          :: flop
 integer, dimension(3)                                     :: sz
-real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) :: v, av, rms, rmsmean
-real                                                      :: val1, val2, u1, u2, u3, accum
+real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) :: v
+real(STORE_KIND), dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) :: av, rms, rmsmean
+real                                                      :: val2, u1, u2, u3, accum
 
 ix = sz(1)
 jx = sz(2)
 kx = sz(3)
 
 val2 = 1.0/accum
-val1 = 1.0 - val2
 
-flop = flop + dble(ix+2*g) * dble(jx+2*g) * dble(kx+2*g) * 45.0d0 + 9.0d0
+flop = flop + dble(ix+2*g) * dble(jx+2*g) * dble(kx+2*g) * 48.0d0 + 8.0d0
 
 !$OMP PARALLEL &
 !$OMP PRIVATE(u1, u2, u3) &
-!$OMP FIRSTPRIVATE(ix, jx, kx, g, val1, val2)
+!$OMP FIRSTPRIVATE(ix, jx, kx, g, val2)
 
 !$OMP DO SCHEDULE(static) COLLAPSE(2)
 do k = 1-g, kx+g
@@ -976,9 +1098,9 @@ rms(i, j, k, 2) = u2
 rms(i, j, k, 3) = u3
 
 ! 時間平均 >> RMS
-rmsmean(i, j, k, 1) = val1 * rmsmean(i, j, k, 1) + val2 * u1
-rmsmean(i, j, k, 2) = val1 * rmsmean(i, j, k, 2) + val2 * u2
-rmsmean(i, j, k, 3) = val1 * rmsmean(i, j, k, 3) + val2 * u3
+rmsmean(i, j, k, 1) = rmsmean(i, j, k, 1) + val2 * ( u1 - rmsmean(i, j, k, 1) )
+rmsmean(i, j, k, 2) = rmsmean(i, j, k, 2) + val2 * ( u2 - rmsmean(i, j, k, 2) )
+rmsmean(i, j, k, 3) = rmsmean(i, j, k, 3) + val2 * ( u3 - rmsmean(i, j, k, 3) )
 end do
 end do
 end do
@@ -991,7 +1113,7 @@ end subroutine calc_rms_v
 !> ********************************************************************
 !! @brief スカラ変数の変動統計情報
 !! @param [out]    rms     瞬間の変動値
-!! @param [in,out] rmsmean 変動値の二乗和の平方根（実効値）
+!! @param [in,out] rmsmean 変動値の絶対値の時間平均
 !! @param [in]     sz      配列長
 !! @param [in]     g       ガイドセル長
 !! @param [in]     s       スカラ変数
@@ -1004,6 +1126,9 @@ end subroutine calc_rms_v
 !!  u^{\prime} ; 変動値 = u - \var{u}
 !!  \sigma     ; 標準偏差 RMS, \sigma = \sqrt{ \var{ {u^{\prime}}^2 } }
 !! Turbulent Intensity = \frac{\sigma}{\var{U}}
+!!
+!! rmsmeanは |u^{\prime}| の時間平均として保持する（統計リスタートファイルと同じ意味）．
+!! 更新は \var{x}_n = \var{x}_{n-1} + ( x - \var{x}_{n-1} ) / n の逐次形で行う
 !<
 subroutine calc_rms_s(rms, rmsmean, sz, g, s, as, accum, flop)
 implicit none
@@ -1011,21 +1136,21 @@ include 'ffv_f_params.h'
 integer                                                   :: ix, jx, kx, i, j, k, g
 double precision                                          :: flop
 integer, dimension(3)                                     :: sz
-real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g)    :: s, as, rms, rmsmean
-real                                                      :: val1, val2, u, u2, accum
+real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g)    :: s, as
+real(STORE_KIND), dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) :: rms, rmsmean
+real                                                      :: val2, u, u2, accum
 
 ix = sz(1)
 jx = sz(2)
 kx = sz(3)
 
 val2 = 1.0/accum
-val1 = 1.0 - val2
 
-flop = flop + dble(ix+2*g) * dble(jx+2*g) * dble(kx+2*g) * 15.0d0 + 9.0d0
+flop = flop + dble(ix+2*g) * dble(jx+2*g) * dble(kx+2*g) * 16.0d0 + 8.0d0
 
 !$OMP PARALLEL &
 !$OMP PRIVATE(u, u2) &
-!$OMP FIRSTPRIVATE(ix, jx, kx, g, val1, val2)
+!$OMP FIRSTPRIVATE(ix, jx, kx, g, val2)
 
 !$OMP DO SCHEDULE(static) COLLAPSE(2)
 do k = 1-g, kx+g
@@ -1038,7 +1163,7 @@ u2 = sqrt( u*u )
 rms(i, j, k) = u2
 
 ! 時間平均 >> RMS
-rmsmean(i, j, k) = val1 * rmsmean(i, j, k) + val2 * u2
+rmsmean(i, j, k) = rmsmean(i, j, k) + val2 * ( u2 - rmsmean(i, j, k) )
 end do
 end do
 end do
@@ -1482,116 +1607,71 @@ end subroutine output_vtk
 
 
 !> ********************************************************************
-!! @param [out]      R       レイノルズ応力テンソル
+!! @brief レイノルズ応力輸送方程式の収支項を一度のスイープで計算
 !! @param [in, out]  R_ave   レイノルズ応力テンソル (時間平均値)
+!! @param [in, out]  P_ave   生成項 (時間平均値)
+!! @param [in, out]  E_ave   散逸項 (時間平均値)
+!! @param [in, out]  T_ave   乱流拡散項 (時間平均値)
+!! @param [in, out]  PI_ave  速度圧力勾配相関項 (時間平均値)
 !! @param [in]       sz      配列長
+!! @param [in]       dh      格子幅
 !! @param [in]       g       ガイドセル長
+!! @param [in]       nu      動粘性係数
 !! @param [in]       v       セルセンター速度ベクトル
 !! @param [in]       v_ave   セルセンター時間平均速度ベクトル
+!! @param [in]       p       セルセンター圧力
+!! @param [in]       ap      セルセンター時間平均圧力
+!! @param [in]       bv      BCindex C
 !! @param [in]       nadd    加算回数
 !! @param [out]      flop    flop count
+!! @note 旧calc_reynolds_stress, calc_production_rate, calc_dissipation_rate,
+!!       calc_turb_transport_rate, calc_vel_pregrad_term を融合したもの（個別カーネルは削除）．
+!!       隣接セルの速度・平均速度・セル状態の読み込みを各項で共有し，
+!!       隣接セルの瞬時レイノルズ応力はその場で計算するため作業配列Rは不要．
+!!       各項の演算順序は旧個別カーネルと同一．R_aveの更新は内部セルのみ
 !<
-subroutine calc_reynolds_stress(R, R_ave, sz, g, v, v_ave, nadd, flop)
-implicit none
-include 'ffv_f_params.h'
-integer                                                   :: ix, jx, kx, i, j, k, g
-integer, dimension(3)                                     :: sz
-real, dimension(6, 1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) :: R, R_ave
-real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) :: v, v_ave
-real                                                      :: v1p, v2p, v3p
-real                                                      :: nadd, val1, val2
-double precision                                          :: flop
-
-ix = sz(1)
-jx = sz(2)
-kx = sz(3)
-
-! 9 flop
-val2 = 1.0/nadd
-val1 = 1.0 - val2
-
-flop = flop + dble(ix+2*g) * dble(jx+2*g) * dble(kx+2*g) * 27.0d0 + 9.0d0
-
-!$OMP PARALLEL &
-!$OMP PRIVATE(v1p, v2p, v3p) &
-!$OMP FIRSTPRIVATE(ix, jx, kx, g, val1, val2)
-
-!$OMP DO SCHEDULE(static) COLLAPSE(2)
-do k = 1-g, kx+g
-do j = 1-g, jx+g
-do i = 1-g, ix+g
-
-      ! 変動速度ベクトルのロード
-      ! 3 flop
-      v1p = v(i, j, k, 1) - v_ave(i, j, k, 1)
-      v2p = v(i, j, k, 2) - v_ave(i, j, k, 2)
-      v3p = v(i, j, k, 3) - v_ave(i, j, k, 3)
-
-      ! レイノルズ応力テンソル
-      ! 6 flop
-      R(1, i, j, k) = v1p * v1p
-      R(2, i, j, k) = v1p * v2p
-      R(3, i, j, k) = v1p * v3p
-      R(4, i, j, k) = v2p * v2p
-      R(5, i, j, k) = v2p * v3p
-      R(6, i, j, k) = v3p * v3p
-
-      ! レイノルズ応力テンソル (時間平均値)
-      ! 18 flop
-      R_ave(1, i, j, k) = val1 * R_ave(1, i, j, k) + val2 * R(1, i, j, k)
-      R_ave(2, i, j, k) = val1 * R_ave(2, i, j, k) + val2 * R(2, i, j, k)
-      R_ave(3, i, j, k) = val1 * R_ave(3, i, j, k) + val2 * R(3, i, j, k)
-      R_ave(4, i, j, k) = val1 * R_ave(4, i, j, k) + val2 * R(4, i, j, k)
-      R_ave(5, i, j, k) = val1 * R_ave(5, i, j, k) + val2 * R(5, i, j, k)
-      R_ave(6, i, j, k) = val1 * R_ave(6, i, j, k) + val2 * R(6, i, j, k)
-
-end do
-end do
-end do
-!$OMP END PARALLEL
-
-return
-end subroutine calc_reynolds_stress
-!> ********************************************************************
-
-
-
-
-
-!> ********************************************************************
-!! @brief 生成項の計算
-!! @param [in, out]  P_ave  生成項 (時間平均値)
-!! @param [in]       sz     配列長
-!! @param [in]       dh     格子幅
-!! @param [in]       g      ガイドセル長
-!! @param [in]       v_ave  セルセンター時間平均速度ベクトル
-!! @param [in]       R      レイノルズ応力テンソル
-!! @param [in]       bv     BCindex C
-!! @param [in]       nadd   加算回数
-!! @param [out]      flop   flop count
-!<
-subroutine calc_production_rate (P_ave, sz, dh, g, v_ave, R, bv, nadd, flop)
+subroutine calc_turb_budget (R_ave, P_ave, E_ave, T_ave, PI_ave, sz, dh, g, nu, v, v_ave, p, ap, bv, nadd, flop)
 implicit none
 include 'ffv_f_params.h'
 integer                                                   ::  i, j, k, ix, jx, kx, g, idx
 integer, dimension(3)                                     ::  sz
 real, dimension(3)                                        ::  dh
-real                                                      ::  R11, R12, R13, R21, R22, R23, R31, R32, R33
 integer                                                   ::  b_e1, b_w1, b_n1, b_s1, b_t1, b_b1
-real                                                      ::  actv, rx, ry, rz
-real                                                      ::  Up0, Ue1, Uw1, Us1, Un1, Ub1, Ut1
-real                                                      ::  Vp0, Ve1, Vw1, Vs1, Vn1, Vb1, Vt1
-real                                                      ::  Wp0, We1, Ww1, Ws1, Wn1, Wb1, Wt1
-real                                                      ::  w_e, w_w, w_n, w_s, w_t, w_b, uq, vq, wq
+real                                                      ::  actv, rx, ry, rz, rpx, rpy, rpz
+real                                                      ::  Um_p0, Um_e1, Um_w1, Um_s1, Um_n1, Um_b1, Um_t1
+real                                                      ::  Vm_p0, Vm_e1, Vm_w1, Vm_s1, Vm_n1, Vm_b1, Vm_t1
+real                                                      ::  Wm_p0, Wm_e1, Wm_w1, Wm_s1, Wm_n1, Wm_b1, Wm_t1
+real                                                      ::  Uf_p0, Uf_e1, Uf_w1, Uf_s1, Uf_n1, Uf_b1, Uf_t1
+real                                                      ::  Vf_p0, Vf_e1, Vf_w1, Vf_s1, Vf_n1, Vf_b1, Vf_t1
+real                                                      ::  Wf_p0, Wf_e1, Wf_w1, Wf_s1, Wf_n1, Wf_b1, Wf_t1
+real                                                      ::  R11_p0, R12_p0, R13_p0, R22_p0, R23_p0, R33_p0
+real                                                      ::  R11_w1, R11_e1, R11_s1, R11_n1, R11_b1, R11_t1
+real                                                      ::  R12_w1, R12_e1, R12_s1, R12_n1, R12_b1, R12_t1
+real                                                      ::  R13_w1, R13_e1, R13_s1, R13_n1, R13_b1, R13_t1
+real                                                      ::  R22_w1, R22_e1, R22_s1, R22_n1, R22_b1, R22_t1
+real                                                      ::  R23_w1, R23_e1, R23_s1, R23_n1, R23_b1, R23_t1
+real                                                      ::  R33_w1, R33_e1, R33_s1, R33_n1, R33_b1, R33_t1
 real                                                      ::  gradU11, gradU12, gradU13
 real                                                      ::  gradU21, gradU22, gradU23
 real                                                      ::  gradU31, gradU32, gradU33
+real                                                      ::  gradF11, gradF12, gradF13
+real                                                      ::  gradF21, gradF22, gradF23
+real                                                      ::  gradF31, gradF32, gradF33
 real                                                      ::  P11_1, P12_1, P13_1, P22_1, P23_1, P33_1
 real                                                      ::  P21_1, P31_1, P32_1
+real                                                      ::  p0, pe1, pn1, pt1
+real                                                      ::  ugradp11, ugradp12, ugradp13
+real                                                      ::  ugradp21, ugradp22, ugradp23
+real                                                      ::  ugradp31, ugradp32, ugradp33
 real                                                      ::  P11, P12, P13, P22, P23, P33
-real, dimension(6, 1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  P_ave, R
-real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  v_ave
-real                                                      ::  nadd, val1, val2
+real                                                      ::  E11, E12, E13, E22, E23, E33
+real                                                      ::  T11, T12, T13, T22, T23, T33
+real                                                      ::  PI11, PI12, PI13, PI22, PI23, PI33
+real(STORE_KIND), dimension(6, 1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  R_ave, P_ave, E_ave, T_ave, PI_ave
+real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  v
+real(STORE_KIND), dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  v_ave
+real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g)    ::  p, ap
+real                                                      ::  nadd, val2, nu
 integer, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  bv
 double precision                                          ::  flop
 
@@ -1599,75 +1679,61 @@ ix = sz(1)
 jx = sz(2)
 kx = sz(3)
 
-! 27 flop
+! 速度勾配は中心差分，圧力勾配は片側差分
+! 54 flop
 rx = 1.0 / (2.0*dh(1))
 ry = 1.0 / (2.0*dh(2))
 rz = 1.0 / (2.0*dh(3))
+rpx = 1.0 / (1.0*dh(1))
+rpy = 1.0 / (1.0*dh(2))
+rpz = 1.0 / (1.0*dh(3))
 
-! 9 flop
+! 8 flop
 val2 = 1.0/nadd
-val1 = 1.0 - val2
 
-flop = flop + dble(ix)*dble(jx)*dble(kx)*133.0d0 + 36.0d0
+flop = flop + dble(ix)*dble(jx)*dble(kx)*485.0d0 + 63.0d0
 
 !$OMP PARALLEL &
-!$OMP PRIVATE(idx, actv, uq, vq, wq) &
-!$OMP PRIVATE(Up0, Ue1, Uw1, Us1, Un1, Ub1, Ut1) &
-!$OMP PRIVATE(Vp0, Ve1, Vw1, Vs1, Vn1, Vb1, Vt1) &
-!$OMP PRIVATE(Wp0, We1, Ww1, Ws1, Wn1, Wb1, Wt1) &
+!$OMP PRIVATE(idx, actv) &
 !$OMP PRIVATE(b_e1, b_w1, b_n1, b_s1, b_t1, b_b1) &
-!$OMP PRIVATE(w_e, w_w, w_n, w_s, w_t, w_b) &
-!$OMP PRIVATE(R11, R12, R13, R22, R23, R33) &
+!$OMP PRIVATE(Um_p0, Um_e1, Um_w1, Um_s1, Um_n1, Um_b1, Um_t1) &
+!$OMP PRIVATE(Vm_p0, Vm_e1, Vm_w1, Vm_s1, Vm_n1, Vm_b1, Vm_t1) &
+!$OMP PRIVATE(Wm_p0, Wm_e1, Wm_w1, Wm_s1, Wm_n1, Wm_b1, Wm_t1) &
+!$OMP PRIVATE(Uf_p0, Uf_e1, Uf_w1, Uf_s1, Uf_n1, Uf_b1, Uf_t1) &
+!$OMP PRIVATE(Vf_p0, Vf_e1, Vf_w1, Vf_s1, Vf_n1, Vf_b1, Vf_t1) &
+!$OMP PRIVATE(Wf_p0, Wf_e1, Wf_w1, Wf_s1, Wf_n1, Wf_b1, Wf_t1) &
+!$OMP PRIVATE(R11_p0, R12_p0, R13_p0, R22_p0, R23_p0, R33_p0) &
+!$OMP PRIVATE(R11_w1, R11_e1, R11_s1, R11_n1, R11_b1, R11_t1) &
+!$OMP PRIVATE(R12_w1, R12_e1, R12_s1, R12_n1, R12_b1, R12_t1) &
+!$OMP PRIVATE(R13_w1, R13_e1, R13_s1, R13_n1, R13_b1, R13_t1) &
+!$OMP PRIVATE(R22_w1, R22_e1, R22_s1, R22_n1, R22_b1, R22_t1) &
+!$OMP PRIVATE(R23_w1, R23_e1, R23_s1, R23_n1, R23_b1, R23_t1) &
+!$OMP PRIVATE(R33_w1, R33_e1, R33_s1, R33_n1, R33_b1, R33_t1) &
 !$OMP PRIVATE(gradU11, gradU12, gradU13) &
 !$OMP PRIVATE(gradU21, gradU22, gradU23) &
 !$OMP PRIVATE(gradU31, gradU32, gradU33) &
+!$OMP PRIVATE(gradF11, gradF12, gradF13) &
+!$OMP PRIVATE(gradF21, gradF22, gradF23) &
+!$OMP PRIVATE(gradF31, gradF32, gradF33) &
 !$OMP PRIVATE(P11_1, P12_1, P13_1, P22_1, P23_1, P33_1) &
 !$OMP PRIVATE(P21_1, P31_1, P32_1) &
+!$OMP PRIVATE(p0, pe1, pn1, pt1) &
+!$OMP PRIVATE(ugradp11, ugradp12, ugradp13) &
+!$OMP PRIVATE(ugradp21, ugradp22, ugradp23) &
+!$OMP PRIVATE(ugradp31, ugradp32, ugradp33) &
 !$OMP PRIVATE(P11, P12, P13, P22, P23, P33) &
-!$OMP FIRSTPRIVATE(ix, jx, kx, rx, ry, rz)
-!$OMP DO SCHEDULE(static)
+!$OMP PRIVATE(E11, E12, E13, E22, E23, E33) &
+!$OMP PRIVATE(T11, T12, T13, T22, T23, T33) &
+!$OMP PRIVATE(PI11, PI12, PI13, PI22, PI23, PI33) &
+!$OMP FIRSTPRIVATE(ix, jx, kx, rx, ry, rz, rpx, rpy, rpz, nu, val2)
 
+!$OMP DO SCHEDULE(static) COLLAPSE(2)
 do k = 1, kx
 do j = 1, jx
 do i = 1, ix
 
-      ! レイノルズ応力テンソル
-      R11 = R(1, i, j, k)
-      R12 = R(2, i, j, k)
-      R13 = R(3, i, j, k)
-      R21 = R12
-      R22 = R(4, i, j, k)
-      R23 = R(5, i, j, k)
-      R31 = R13
-      R32 = R23
-      R33 = R(6, i, j, k)
-
       idx = bv(i,j,k)
 
-      Ub1 = v_ave(i  ,j  ,k-1, 1)
-      Us1 = v_ave(i  ,j-1,k  , 1)
-      Uw1 = v_ave(i-1,j  ,k  , 1)
-      Up0 = v_ave(i  ,j  ,k  , 1)
-      Ue1 = v_ave(i+1,j  ,k  , 1)
-      Un1 = v_ave(i  ,j+1,k  , 1)
-      Ut1 = v_ave(i  ,j  ,k+1, 1)
-
-      Vb1 = v_ave(i  ,j  ,k-1, 2)
-      Vs1 = v_ave(i  ,j-1,k  , 2)
-      Vw1 = v_ave(i-1,j  ,k  , 2)
-      Vp0 = v_ave(i  ,j  ,k  , 2)
-      Ve1 = v_ave(i+1,j  ,k  , 2)
-      Vn1 = v_ave(i  ,j+1,k  , 2)
-      Vt1 = v_ave(i  ,j  ,k+1, 2)
-
-      Wb1 = v_ave(i  ,j  ,k-1, 3)
-      Ws1 = v_ave(i  ,j-1,k  , 3)
-      Ww1 = v_ave(i-1,j  ,k  , 3)
-      Wp0 = v_ave(i  ,j  ,k  , 3)
-      We1 = v_ave(i+1,j  ,k  , 3)
-      Wn1 = v_ave(i  ,j+1,k  , 3)
-      Wt1 = v_ave(i  ,j  ,k+1, 3)
-
       ! セル状態 (0-solid / 1-fluid) > 1 flop
       actv= real(ibits(idx, State, 1))
 
@@ -1677,478 +1743,118 @@ do i = 1, ix
       b_n1= ibits(bv(i  ,j+1,k  ), State, 1)
       b_b1= ibits(bv(i  ,j  ,k-1), State, 1)
       b_t1= ibits(bv(i  ,j  ,k+1), State, 1)
-      
-      ! 隣接セルの状態で置換フラグをセット セル状態 (0-solid / 1-fluid) > 12 flop
-      w_e = real(b_e1) * actv
-      w_w = real(b_w1) * actv
-      w_n = real(b_n1) * actv
-      w_s = real(b_s1) * actv
-      w_t = real(b_t1) * actv
-      w_b = real(b_b1) * actv
-
-      ! セルセンターからの壁面修正速度 > 6 flop
-      uq = -Up0
-      vq = -Vp0
-      wq = -Wp0
-
-      ! 壁面の場合の参照速度の修正
-      if ( b_e1 == 0 ) then
-         Ue1 = uq
-         Ve1 = vq
-         We1 = wq
-      endif
-
-      if ( b_w1 == 0 ) then
-         Uw1 = uq
-         Vw1 = vq
-         Ww1 = wq
-      end if
-
-      if ( b_n1 == 0 ) then
-         Un1 = uq
-         Vn1 = vq
-         Wn1 = wq
-      end if
-
-      if ( b_s1 == 0 ) then
-         Us1 = uq
-         Vs1 = vq
-         Ws1 = wq
-      end if
-
-      if ( b_t1 == 0 ) then
-         Ut1 = uq
-         Vt1 = vq
-         Wt1 = wq
-      end if
-
-      if ( b_b1 == 0 ) then
-         Ub1 = uq
-         Vb1 = vq
-         Wb1 = wq
-      end if
-
-      ! 平均速度勾配テンソル 
-      ! 27 flop
-      gradU11 = rx * ( Ue1 - Uw1 ) * actv
-      gradU12 = rx * ( Ve1 - Vw1 ) * actv
-      gradU13 = rx * ( We1 - Ww1 ) * actv
-      gradU21 = ry * ( Un1 - Us1 ) * actv
-      gradU22 = ry * ( Vn1 - Vs1 ) * actv
-      gradU23 = ry * ( Wn1 - Ws1 ) * actv
-      gradU31 = rz * ( Ut1 - Ub1 ) * actv
-      gradU32 = rz * ( Vt1 - Vb1 ) * actv
-      gradU33 = rz * ( Wt1 - Wb1 ) * actv
-
-      ! 生成項第一項
-      ! 45 flop
-      P11_1 = R11*gradU11 + R12*gradU21 + R13*gradU31
-      P12_1 = R11*gradU12 + R12*gradU22 + R13*gradU32
-      P13_1 = R11*gradU13 + R12*gradU23 + R13*gradU33
-      P21_1 = R21*gradU11 + R22*gradU21 + R23*gradU31
-      P22_1 = R21*gradU12 + R22*gradU22 + R23*gradU32
-      P23_1 = R21*gradU13 + R22*gradU23 + R23*gradU33
-      P31_1 = R31*gradU11 + R32*gradU21 + R33*gradU31
-      P32_1 = R31*gradU12 + R32*gradU22 + R33*gradU32
-      P33_1 = R31*gradU13 + R32*gradU23 + R33*gradU33
-
-      ! 生成項 (生成項第一項 + 第一項の転置項)
-      ! 24 flop
-      P11 = -( P11_1 + P11_1 ) * actv
-      P12 = -( P12_1 + P21_1 ) * actv
-      P13 = -( P13_1 + P31_1 ) * actv
-      P22 = -( P22_1 + P22_1 ) * actv
-      P23 = -( P23_1 + P32_1 ) * actv
-      P33 = -( P33_1 + P33_1 ) * actv
-
-      ! 生成項 (時間平均値)
-      ! 18 flop
-      P_ave(1, i, j, k) = val1 * P_ave(1, i, j, k) + val2 * P11
-      P_ave(2, i, j, k) = val1 * P_ave(2, i, j, k) + val2 * P12
-      P_ave(3, i, j, k) = val1 * P_ave(3, i, j, k) + val2 * P13
-      P_ave(4, i, j, k) = val1 * P_ave(4, i, j, k) + val2 * P22
-      P_ave(5, i, j, k) = val1 * P_ave(5, i, j, k) + val2 * P23
-      P_ave(6, i, j, k) = val1 * P_ave(6, i, j, k) + val2 * P33
-
-end do
-end do
-end do
-!$OMP END DO
-!$OMP END PARALLEL
-
-return
-end subroutine calc_production_rate
-!> ********************************************************************
-
-
-
-
-
-!> ********************************************************************
-!! @brief 散逸項の計算
-!! @param [out]  E_ave  散逸項 (時間平均値)
-!! @param [in]   sz     配列長
-!! @param [in]   dh     格子幅
-!! @param [in]   g      ガイドセル長
-!! @param [in]   nu     動粘性係数
-!! @param [in]   v      セルセンター速度ベクトル
-!! @param [in]   v_ave  セルセンター時間平均速度ベクトル
-!! @param [in]   bv     BCindex C
-!! @param [in]   nadd   加算回数
-!! @param [out]  flop   flop count
-!<
-subroutine calc_dissipation_rate (E_ave, sz, dh, g, nu, v, v_ave, bv, nadd, flop)
-implicit none
-include 'ffv_f_params.h'
-integer                                                   ::  i, j, k, ix, jx, kx, g, idx
-integer, dimension(3)                                     ::  sz
-real, dimension(3)                                        ::  dh
-integer                                                   ::  b_e1, b_w1, b_n1, b_s1, b_t1, b_b1
-real                                                      ::  actv, rx, ry, rz
-real                                                      ::  Up0, Ue1, Uw1, Us1, Un1, Ub1, Ut1
-real                                                      ::  Vp0, Ve1, Vw1, Vs1, Vn1, Vb1, Vt1
-real                                                      ::  Wp0, We1, Ww1, Ws1, Wn1, Wb1, Wt1
-real                                                      ::  w_e, w_w, w_n, w_s, w_t, w_b, uq, vq, wq
-real                                                      ::  gradU11, gradU12, gradU13
-real                                                      ::  gradU21, gradU22, gradU23
-real                                                      ::  gradU31, gradU32, gradU33
-real                                                      ::  gradUt11, gradUt12, gradUt13
-real                                                      ::  gradUt21, gradUt22, gradUt23
-real                                                      ::  gradUt31, gradUt32, gradUt33
-real                                                      ::  E11, E12, E13, E22, E23, E33
-real, dimension(6, 1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  E_ave
-real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  v, v_ave
-real                                                      ::  nadd, val1, val2, nu
-integer, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  bv
-double precision                                          ::  flop
-
-ix = sz(1)
-jx = sz(2)
-kx = sz(3)
-
-! 27 flop
-rx = 1.0 / (2.0*dh(1))
-ry = 1.0 / (2.0*dh(2))
-rz = 1.0 / (2.0*dh(3))
-
-! 9 flop
-val2 = 1.0/nadd
-val1 = 1.0 - val2
-
-flop = flop + dble(ix)*dble(jx)*dble(kx)*131.0d0 + 36.0d0
-
-
-!$OMP PARALLEL &
-!$OMP PRIVATE(idx, actv, uq, vq, wq) &
-!$OMP PRIVATE(Up0, Ue1, Uw1, Us1, Un1, Ub1, Ut1) &
-!$OMP PRIVATE(Vp0, Ve1, Vw1, Vs1, Vn1, Vb1, Vt1) &
-!$OMP PRIVATE(Wp0, We1, Ww1, Ws1, Wn1, Wb1, Wt1) &
-!$OMP PRIVATE(b_e1, b_w1, b_n1, b_s1, b_t1, b_b1) &
-!$OMP PRIVATE(w_e, w_w, w_n, w_s, w_t, w_b) &
-!$OMP PRIVATE(gradU11, gradU12, gradU13) &
-!$OMP PRIVATE(gradU21, gradU22, gradU23) &
-!$OMP PRIVATE(gradU31, gradU32, gradU33) &
-!$OMP PRIVATE(gradUt11, gradUt12, gradUt13) &
-!$OMP PRIVATE(gradUt21, gradUt22, gradUt23) &
-!$OMP PRIVATE(gradUt31, gradUt32, gradUt33) &
-!$OMP PRIVATE(E11, E12, E13, E22, E23, E33) &
-!$OMP FIRSTPRIVATE(ix, jx, kx, rx, ry, rz, nu)
-!$OMP DO SCHEDULE(static)
-
-do k = 1, kx
-do j = 1, jx
-do i = 1, ix
-      idx = bv(i,j,k)
 
+      ! 時間平均速度
+      Um_b1 = v_ave(i  ,j  ,k-1, 1)
+      Um_s1 = v_ave(i  ,j-1,k  , 1)
+      Um_w1 = v_ave(i-1,j  ,k  , 1)
+      Um_p0 = v_ave(i  ,j  ,k  , 1)
+      Um_e1 = v_ave(i+1,j  ,k  , 1)
+      Um_n1 = v_ave(i  ,j+1,k  , 1)
+      Um_t1 = v_ave(i  ,j  ,k+1, 1)
+
+      Vm_b1 = v_ave(i  ,j  ,k-1, 2)
+      Vm_s1 = v_ave(i  ,j-1,k  , 2)
+      Vm_w1 = v_ave(i-1,j  ,k  , 2)
+      Vm_p0 = v_ave(i  ,j  ,k  , 2)
+      Vm_e1 = v_ave(i+1,j  ,k  , 2)
+      Vm_n1 = v_ave(i  ,j+1,k  , 2)
+      Vm_t1 = v_ave(i  ,j  ,k+1, 2)
+
+      Wm_b1 = v_ave(i  ,j  ,k-1, 3)
+      Wm_s1 = v_ave(i  ,j-1,k  , 3)
+      Wm_w1 = v_ave(i-1,j  ,k  , 3)
+      Wm_p0 = v_ave(i  ,j  ,k  , 3)
+      Wm_e1 = v_ave(i+1,j  ,k  , 3)
+      Wm_n1 = v_ave(i  ,j+1,k  , 3)
+      Wm_t1 = v_ave(i  ,j  ,k+1, 3)
+
+      ! 変動速度
       ! 21 flop
-      Ub1 = v(i  ,j  ,k-1, 1) - v_ave(i  ,j  ,k-1, 1)
-      Us1 = v(i  ,j-1,k  , 1) - v_ave(i  ,j-1,k  , 1)
-      Uw1 = v(i-1,j  ,k  , 1) - v_ave(i-1,j  ,k  , 1)
-      Up0 = v(i  ,j  ,k  , 1) - v_ave(i  ,j  ,k  , 1)
-      Ue1 = v(i+1,j  ,k  , 1) - v_ave(i+1,j  ,k  , 1)
-      Un1 = v(i  ,j+1,k  , 1) - v_ave(i  ,j+1,k  , 1)
-      Ut1 = v(i  ,j  ,k+1, 1) - v_ave(i  ,j  ,k+1, 1)
-
-      Vb1 = v(i  ,j  ,k-1, 2) - v_ave(i  ,j  ,k-1, 2)
-      Vs1 = v(i  ,j-1,k  , 2) - v_ave(i  ,j-1,k  , 2)
-      Vw1 = v(i-1,j  ,k  , 2) - v_ave(i-1,j  ,k  , 2)
-      Vp0 = v(i  ,j  ,k  , 2) - v_ave(i  ,j  ,k  , 2)
-      Ve1 = v(i+1,j  ,k  , 2) - v_ave(i+1,j  ,k  , 2)
-      Vn1 = v(i  ,j+1,k  , 2) - v_ave(i  ,j+1,k  , 2)
-      Vt1 = v(i  ,j  ,k+1, 2) - v_ave(i  ,j  ,k+1, 2)
-
-      Wb1 = v(i  ,j  ,k-1, 3) - v_ave(i  ,j  ,k-1, 3)
-      Ws1 = v(i  ,j-1,k  , 3) - v_ave(i  ,j-1,k  , 3)
-      Ww1 = v(i-1,j  ,k  , 3) - v_ave(i-1,j  ,k  , 3)
-      Wp0 = v(i  ,j  ,k  , 3) - v_ave(i  ,j  ,k  , 3)
-      We1 = v(i+1,j  ,k  , 3) - v_ave(i+1,j  ,k  , 3)
-      Wn1 = v(i  ,j+1,k  , 3) - v_ave(i  ,j+1,k  , 3)
-      Wt1 = v(i  ,j  ,k+1, 3) - v_ave(i  ,j  ,k+1, 3)
-
-      ! セル状態 (0-solid / 1-fluid) > 1 flop
-      actv= real(ibits(idx, State, 1))
-
-      b_w1= ibits(bv(i-1,j  ,k  ), State, 1)
-      b_e1= ibits(bv(i+1,j  ,k  ), State, 1)
-      b_s1= ibits(bv(i  ,j-1,k  ), State, 1)
-      b_n1= ibits(bv(i  ,j+1,k  ), State, 1)
-      b_b1= ibits(bv(i  ,j  ,k-1), State, 1)
-      b_t1= ibits(bv(i  ,j  ,k+1), State, 1)
-      
-      ! 隣接セルの状態で置換フラグをセット セル状態 (0-solid / 1-fluid) > 12 flop
-      w_e = real(b_e1) * actv
-      w_w = real(b_w1) * actv
-      w_n = real(b_n1) * actv
-      w_s = real(b_s1) * actv
-      w_t = real(b_t1) * actv
-      w_b = real(b_b1) * actv
-
-      ! セルセンターからの壁面修正速度 > 6 flop
-      uq = -Up0
-      vq = -Vp0
-      wq = -Wp0
-
-      ! 壁面の場合の参照速度の修正
-      if ( b_e1 == 0 ) then
-         Ue1 = uq
-         Ve1 = vq
-         We1 = wq
-      endif
-
-      if ( b_w1 == 0 ) then
-         Uw1 = uq
-         Vw1 = vq
-         Ww1 = wq
-      end if
-
-      if ( b_n1 == 0 ) then
-         Un1 = uq
-         Vn1 = vq
-         Wn1 = wq
-      end if
-
-      if ( b_s1 == 0 ) then
-         Us1 = uq
-         Vs1 = vq
-         Ws1 = wq
-      end if
-
-      if ( b_t1 == 0 ) then
-         Ut1 = uq
-         Vt1 = vq
-         Wt1 = wq
-      end if
-
-      if ( b_b1 == 0 ) then
-         Ub1 = uq
-         Vb1 = vq
-         Wb1 = wq
-      end if
-
-      ! 速度変動勾配テンソル 
-      ! 27 flop
-      gradU11 = rx * ( Ue1 - Uw1 ) * actv
-      gradU12 = rx * ( Ve1 - Vw1 ) * actv
-      gradU13 = rx * ( We1 - Ww1 ) * actv
-      gradU21 = ry * ( Un1 - Us1 ) * actv
-      gradU22 = ry * ( Vn1 - Vs1 ) * actv
-      gradU23 = ry * ( Wn1 - Ws1 ) * actv
-      gradU31 = rz * ( Ut1 - Ub1 ) * actv
-      gradU32 = rz * ( Vt1 - Vb1 ) * actv
-      gradU33 = rz * ( Wt1 - Wb1 ) * actv
-
-      ! 速度変動勾配テンソルの転置
-      gradUt11 = gradU11
-      gradUt12 = gradU21
-      gradUt13 = gradU31
-      gradUt21 = gradU12
-      gradUt22 = gradU22
-      gradUt23 = gradU32
-      gradUt31 = gradU13
-      gradUt32 = gradU23
-      gradUt33 = gradU33
-
-      ! 散逸項
-      ! 48 flop
-      E11 = 2 * nu * ( gradUt11*gradU11 + gradUt12*gradU21 + gradUt13*gradU31 ) * actv
-      E12 = 2 * nu * ( gradUt11*gradU12 + gradUt12*gradU22 + gradUt13*gradU32 ) * actv
-      E13 = 2 * nu * ( gradUt11*gradU13 + gradUt12*gradU23 + gradUt13*gradU33 ) * actv
-      E22 = 2 * nu * ( gradUt21*gradU12 + gradUt22*gradU22 + gradUt23*gradU32 ) * actv
-      E23 = 2 * nu * ( gradUt21*gradU13 + gradUt22*gradU23 + gradUt23*gradU33 ) * actv
-      E33 = 2 * nu * ( gradUt31*gradU13 + gradUt32*gradU23 + gradUt33*gradU33 ) * actv
-
-      ! 散逸項 (時間平均値)
-      ! 18 flop
-      E_ave(1, i, j, k) = val1 * E_ave(1, i, j, k) + val2 * E11
-      E_ave(2, i, j, k) = val1 * E_ave(2, i, j, k) + val2 * E12
-      E_ave(3, i, j, k) = val1 * E_ave(3, i, j, k) + val2 * E13
-      E_ave(4, i, j, k) = val1 * E_ave(4, i, j, k) + val2 * E22
-      E_ave(5, i, j, k) = val1 * E_ave(5, i, j, k) + val2 * E23
-      E_ave(6, i, j, k) = val1 * E_ave(6, i, j, k) + val2 * E33
-
-end do
-end do
-end do
-!$OMP END DO
-!$OMP END PARALLEL
-
-
-return
-end subroutine calc_dissipation_rate
-!> ********************************************************************
-
-
-
-
-
-!> ********************************************************************
-!! @brief 乱流拡散項の計算
-!! @param [in, out]  T_ave  乱流拡散項 (時間平均値)
-!! @param [in]       sz     配列長
-!! @param [in]       dh     格子幅
-!! @param [in]       g      ガイドセル長
-!! @param [in]       v      セルセンター速度ベクトル
-!! @param [in]       v_ave  セルセンター時間平均速度ベクトル
-!! @param [in]       R      レイノルズ応力テンソル
-!! @param [in]       bv     BCindex C
-!! @param [in]       nadd   加算回数
-!! @param [out]      flop   flop count
-!<
-subroutine calc_turb_transport_rate (T_ave, sz, dh, g, v, v_ave, R, bv, nadd, flop)
-implicit none
-include 'ffv_f_params.h'
-integer                                                   ::  i, j, k, ix, jx, kx, g, idx
-real, dimension(3)                                        ::  dh
-double precision                                          ::  flop
-integer, dimension(3)                                     ::  sz
-integer                                                   ::  b_e1, b_w1, b_n1, b_s1, b_t1, b_b1
-real                                                      ::  actv, rx, ry, rz
-real                                                      ::  v1p, v2p, v3p
-real                                                      ::  R11_p0, R12_p0, R13_p0, R22_p0, R23_p0, R33_p0
-real                                                      ::  R11_w1, R11_e1, R11_s1, R11_n1, R11_b1, R11_t1
-real                                                      ::  R12_w1, R12_e1, R12_s1, R12_n1, R12_b1, R12_t1
-real                                                      ::  R13_w1, R13_e1, R13_s1, R13_n1, R13_b1, R13_t1
-real                                                      ::  R22_w1, R22_e1, R22_s1, R22_n1, R22_b1, R22_t1
-real                                                      ::  R23_w1, R23_e1, R23_s1, R23_n1, R23_b1, R23_t1
-real                                                      ::  R33_w1, R33_e1, R33_s1, R33_n1, R33_b1, R33_t1
-real                                                      ::  T11, T12, T13, T22, T23, T33
-real                                                      ::  w_e, w_w, w_n, w_s, w_t, w_b, uq, vq, wq
-real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  v, v_ave
-real, dimension(6, 1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  R, T_ave
-integer, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  bv
-real                                                      ::  nadd, val1, val2
-
-ix = sz(1)
-jx = sz(2)
-kx = sz(3)
-
-! 27 flop
-rx = 1.0 / (2.0*dh(1))
-ry = 1.0 / (2.0*dh(2))
-rz = 1.0 / (2.0*dh(3))
-
-! 9 flop
-val2 = 1.0/nadd
-val1 = 1.0 - val2
-
-flop = flop + dble(ix)*dble(jx)*dble(kx)*118.0d0 + 36.0d0
-
-!$OMP PARALLEL &
-!$OMP PRIVATE(idx, actv, uq, vq, wq) &
-!$OMP PRIVATE(v1p, v2p, v3p) &
-!$OMP PRIVATE(R11_w1, R11_e1, R11_s1, R11_n1, R11_b1, R11_t1) &
-!$OMP PRIVATE(R12_w1, R12_e1, R12_s1, R12_n1, R12_b1, R12_t1) &
-!$OMP PRIVATE(R13_w1, R13_e1, R13_s1, R13_n1, R13_b1, R13_t1) &
-!$OMP PRIVATE(R22_w1, R22_e1, R22_s1, R22_n1, R22_b1, R22_t1) &
-!$OMP PRIVATE(R23_w1, R23_e1, R23_s1, R23_n1, R23_b1, R23_t1) &
-!$OMP PRIVATE(R33_w1, R33_e1, R33_s1, R33_n1, R33_b1, R33_t1) &
-!$OMP PRIVATE(b_e1, b_w1, b_n1, b_s1, b_t1, b_b1) &
-!$OMP PRIVATE(w_e, w_w, w_n, w_s, w_t, w_b) &
-!$OMP FIRSTPRIVATE(ix, jx, kx, rx, ry, rz, val1, val2)
-
-!$OMP DO SCHEDULE(static) COLLAPSE(2)
-
-do k=1,kx
-do j=1,jx
-do i=1,ix
-
-      idx = bv(i,j,k)
-
-      ! 変動速度ベクトル
-      ! 3 flop
-      v1p = v(i, j, k, 1) - v_ave(i, j, k, 1)
-      v2p = v(i, j, k, 2) - v_ave(i, j, k, 2)
-      v3p = v(i, j, k, 3) - v_ave(i, j, k, 3)
-
-      ! レイノルズ応力テンソル
-      R11_b1 = R(1, i,   j,   k-1)
-      R11_s1 = R(1, i,   j-1, k  )
-      R11_w1 = R(1, i-1, j,   k  )
-      R11_p0 = R(1, i,   j,   k  )
-      R11_e1 = R(1, i+1, j,   k  )
-      R11_n1 = R(1, i,   j+1, k  )
-      R11_t1 = R(1, i,   j,   k+1)
-
-      R12_b1 = R(2, i,   j,   k-1)
-      R12_s1 = R(2, i,   j-1, k  )
-      R12_w1 = R(2, i-1, j,   k  )
-      R12_p0 = R(2, i,   j,   k  )
-      R12_e1 = R(2, i+1, j,   k  )
-      R12_n1 = R(2, i,   j+1, k  )
-      R12_t1 = R(2, i,   j,   k+1)
-
-      R13_b1 = R(3, i,   j,   k-1)
-      R13_s1 = R(3, i,   j-1, k  )
-      R13_w1 = R(3, i-1, j,   k  )
-      R13_p0 = R(3, i,   j,   k  )
-      R13_e1 = R(3, i+1, j,   k  )
-      R13_n1 = R(3, i,   j+1, k  )
-      R13_t1 = R(3, i,   j,   k+1)
-
-      R22_b1 = R(4, i,   j,   k-1)
-      R22_s1 = R(4, i,   j-1, k  )
-      R22_w1 = R(4, i-1, j,   k  )
-      R22_p0 = R(4, i,   j,   k  )
-      R22_e1 = R(4, i+1, j,   k  )
-      R22_n1 = R(4, i,   j+1, k  )
-      R22_t1 = R(4, i,   j,   k+1)
-
-      R23_b1 = R(5, i,   j,   k-1)
-      R23_s1 = R(5, i,   j-1, k  )
-      R23_w1 = R(5, i-1, j,   k  )
-      R23_p0 = R(5, i,   j,   k  )
-      R23_e1 = R(5, i+1, j,   k  )
-      R23_n1 = R(5, i,   j+1, k  )
-      R23_t1 = R(5, i,   j,   k+1)
-
-      R33_b1 = R(6, i,   j,   k-1)
-      R33_s1 = R(6, i,   j-1, k  )
-      R33_w1 = R(6, i-1, j,   k  )
-      R33_p0 = R(6, i,   j,   k  )
-      R33_e1 = R(6, i+1, j,   k  )
-      R33_n1 = R(6, i,   j+1, k  )
-      R33_t1 = R(6, i,   j,   k+1)
-
-      ! セル状態 (0-solid / 1-fluid) > 1 flop
-      actv= real(ibits(idx, State, 1))
-      
-      b_w1= ibits(bv(i-1,j  ,k  ), State, 1)
-      b_e1= ibits(bv(i+1,j  ,k  ), State, 1)
-      b_s1= ibits(bv(i  ,j-1,k  ), State, 1)
-      b_n1= ibits(bv(i  ,j+1,k  ), State, 1)
-      b_b1= ibits(bv(i  ,j  ,k-1), State, 1)
-      b_t1= ibits(bv(i  ,j  ,k+1), State, 1)
-      
-      ! 隣接セルの状態で置換フラグをセット セル状態 (0-solid / 1-fluid) > 12 flop
-      w_e = real(b_e1) * actv
-      w_w = real(b_w1) * actv
-      w_n = real(b_n1) * actv
-      w_s = real(b_s1) * actv
-      w_t = real(b_t1) * actv
-      w_b = real(b_b1) * actv
-      
-      ! 壁面の場合の参照速度の修正
+      Uf_b1 = v(i  ,j  ,k-1, 1) - Um_b1
+      Uf_s1 = v(i  ,j-1,k  , 1) - Um_s1
+      Uf_w1 = v(i-1,j  ,k  , 1) - Um_w1
+      Uf_p0 = v(i  ,j  ,k  , 1) - Um_p0
+      Uf_e1 = v(i+1,j  ,k  , 1) - Um_e1
+      Uf_n1 = v(i  ,j+1,k  , 1) - Um_n1
+      Uf_t1 = v(i  ,j  ,k+1, 1) - Um_t1
+
+      Vf_b1 = v(i  ,j  ,k-1, 2) - Vm_b1
+      Vf_s1 = v(i  ,j-1,k  , 2) - Vm_s1
+      Vf_w1 = v(i-1,j  ,k  , 2) - Vm_w1
+      Vf_p0 = v(i  ,j  ,k  , 2) - Vm_p0
+      Vf_e1 = v(i+1,j  ,k  , 2) - Vm_e1
+      Vf_n1 = v(i  ,j+1,k  , 2) - Vm_n1
+      Vf_t1 = v(i  ,j  ,k+1, 2) - Vm_t1
+
+      Wf_b1 = v(i  ,j  ,k-1, 3) - Wm_b1
+      Wf_s1 = v(i  ,j-1,k  , 3) - Wm_s1
+      Wf_w1 = v(i-1,j  ,k  , 3) - Wm_w1
+      Wf_p0 = v(i  ,j  ,k  , 3) - Wm_p0
+      Wf_e1 = v(i+1,j  ,k  , 3) - Wm_e1
+      Wf_n1 = v(i  ,j+1,k  , 3) - Wm_n1
+      Wf_t1 = v(i  ,j  ,k+1, 3) - Wm_t1
+
+      ! 瞬時レイノルズ応力テンソル (自セルと隣接6セル)
+      ! 42 flop
+      R11_p0 = Uf_p0 * Uf_p0
+      R12_p0 = Uf_p0 * Vf_p0
+      R13_p0 = Uf_p0 * Wf_p0
+      R22_p0 = Vf_p0 * Vf_p0
+      R23_p0 = Vf_p0 * Wf_p0
+      R33_p0 = Wf_p0 * Wf_p0
+
+      R11_w1 = Uf_w1 * Uf_w1
+      R12_w1 = Uf_w1 * Vf_w1
+      R13_w1 = Uf_w1 * Wf_w1
+      R22_w1 = Vf_w1 * Vf_w1
+      R23_w1 = Vf_w1 * Wf_w1
+      R33_w1 = Wf_w1 * Wf_w1
+
+      R11_e1 = Uf_e1 * Uf_e1
+      R12_e1 = Uf_e1 * Vf_e1
+      R13_e1 = Uf_e1 * Wf_e1
+      R22_e1 = Vf_e1 * Vf_e1
+      R23_e1 = Vf_e1 * Wf_e1
+      R33_e1 = Wf_e1 * Wf_e1
+
+      R11_s1 = Uf_s1 * Uf_s1
+      R12_s1 = Uf_s1 * Vf_s1
+      R13_s1 = Uf_s1 * Wf_s1
+      R22_s1 = Vf_s1 * Vf_s1
+      R23_s1 = Vf_s1 * Wf_s1
+      R33_s1 = Wf_s1 * Wf_s1
+
+      R11_n1 = Uf_n1 * Uf_n1
+      R12_n1 = Uf_n1 * Vf_n1
+      R13_n1 = Uf_n1 * Wf_n1
+      R22_n1 = Vf_n1 * Vf_n1
+      R23_n1 = Vf_n1 * Wf_n1
+      R33_n1 = Wf_n1 * Wf_n1
+
+      R11_b1 = Uf_b1 * Uf_b1
+      R12_b1 = Uf_b1 * Vf_b1
+      R13_b1 = Uf_b1 * Wf_b1
+      R22_b1 = Vf_b1 * Vf_b1
+      R23_b1 = Vf_b1 * Wf_b1
+      R33_b1 = Wf_b1 * Wf_b1
+
+      R11_t1 = Uf_t1 * Uf_t1
+      R12_t1 = Uf_t1 * Vf_t1
+      R13_t1 = Uf_t1 * Wf_t1
+      R22_t1 = Vf_t1 * Vf_t1
+      R23_t1 = Vf_t1 * Wf_t1
+      R33_t1 = Wf_t1 * Wf_t1
+
+      ! 壁面の場合の参照値の修正 (平均速度，変動速度，レイノルズ応力)
+      ! 12 flop
       if ( b_e1 == 0 ) then
+        Um_e1 = -Um_p0
+        Vm_e1 = -Vm_p0
+        Wm_e1 = -Wm_p0
+        Uf_e1 = -Uf_p0
+        Vf_e1 = -Vf_p0
+        Wf_e1 = -Wf_p0
         R11_e1 = -R11_p0
         R12_e1 = -R12_p0
         R13_e1 = -R13_p0
@@ -2156,8 +1862,14 @@ do i=1,ix
         R23_e1 = -R23_p0
         R33_e1 = -R33_p0
       endif
-      
+
       if ( b_w1 == 0 ) then
+        Um_w1 = -Um_p0
+        Vm_w1 = -Vm_p0
+        Wm_w1 = -Wm_p0
+        Uf_w1 = -Uf_p0
+        Vf_w1 = -Vf_p0
+        Wf_w1 = -Wf_p0
         R11_w1 = -R11_p0
         R12_w1 = -R12_p0
         R13_w1 = -R13_p0
@@ -2165,8 +1877,14 @@ do i=1,ix
         R23_w1 = -R23_p0
         R33_w1 = -R33_p0
       end if
-      
+
       if ( b_n1 == 0 ) then
+        Um_n1 = -Um_p0
+        Vm_n1 = -Vm_p0
+        Wm_n1 = -Wm_p0
+        Uf_n1 = -Uf_p0
+        Vf_n1 = -Vf_p0
+        Wf_n1 = -Wf_p0
         R11_n1 = -R11_p0
         R12_n1 = -R12_p0
         R13_n1 = -R13_p0
@@ -2174,8 +1892,14 @@ do i=1,ix
         R23_n1 = -R23_p0
         R33_n1 = -R33_p0
       end if
-      
+
       if ( b_s1 == 0 ) then
+        Um_s1 = -Um_p0
+        Vm_s1 = -Vm_p0
+        Wm_s1 = -Wm_p0
+        Uf_s1 = -Uf_p0
+        Vf_s1 = -Vf_p0
+        Wf_s1 = -Wf_p0
         R11_s1 = -R11_p0
         R12_s1 = -R12_p0
         R13_s1 = -R13_p0
@@ -2183,8 +1907,14 @@ do i=1,ix
         R23_s1 = -R23_p0
         R33_s1 = -R33_p0
       end if
-      
+
       if ( b_t1 == 0 ) then
+        Um_t1 = -Um_p0
+        Vm_t1 = -Vm_p0
+        Wm_t1 = -Wm_p0
+        Uf_t1 = -Uf_p0
+        Vf_t1 = -Vf_p0
+        Wf_t1 = -Wf_p0
         R11_t1 = -R11_p0
         R12_t1 = -R12_p0
         R13_t1 = -R13_p0
@@ -2192,8 +1922,14 @@ do i=1,ix
         R23_t1 = -R23_p0
         R33_t1 = -R33_p0
       end if
-      
+
       if ( b_b1 == 0 ) then
+        Um_b1 = -Um_p0
+        Vm_b1 = -Vm_p0
+        Wm_b1 = -Wm_p0
+        Uf_b1 = -Uf_p0
+        Vf_b1 = -Vf_p0
+        Wf_b1 = -Wf_p0
         R11_b1 = -R11_p0
         R12_b1 = -R12_p0
         R13_b1 = -R13_p0
@@ -2201,219 +1937,155 @@ do i=1,ix
         R23_b1 = -R23_p0
         R33_b1 = -R33_p0
       end if
-      
-      ! 乱流拡散項
+
+      ! 平均速度勾配テンソル
+      ! 27 flop
+      gradU11 = rx * ( Um_e1 - Um_w1 ) * actv
+      gradU12 = rx * ( Vm_e1 - Vm_w1 ) * actv
+      gradU13 = rx * ( Wm_e1 - Wm_w1 ) * actv
+      gradU21 = ry * ( Um_n1 - Um_s1 ) * actv
+      gradU22 = ry * ( Vm_n1 - Vm_s1 ) * actv
+      gradU23 = ry * ( Wm_n1 - Wm_s1 ) * actv
+      gradU31 = rz * ( Um_t1 - Um_b1 ) * actv
+      gradU32 = rz * ( Vm_t1 - Vm_b1 ) * actv
+      gradU33 = rz * ( Wm_t1 - Wm_b1 ) * actv
+
+      ! 速度変動勾配テンソル
+      ! 27 flop
+      gradF11 = rx * ( Uf_e1 - Uf_w1 ) * actv
+      gradF12 = rx * ( Vf_e1 - Vf_w1 ) * actv
+      gradF13 = rx * ( Wf_e1 - Wf_w1 ) * actv
+      gradF21 = ry * ( Uf_n1 - Uf_s1 ) * actv
+      gradF22 = ry * ( Vf_n1 - Vf_s1 ) * actv
+      gradF23 = ry * ( Wf_n1 - Wf_s1 ) * actv
+      gradF31 = rz * ( Uf_t1 - Uf_b1 ) * actv
+      gradF32 = rz * ( Vf_t1 - Vf_b1 ) * actv
+      gradF33 = rz * ( Wf_t1 - Wf_b1 ) * actv
+
+      ! (1) 生成項 (生成項第一項 + 第一項の転置項)
+      ! 69 flop
+      P11_1 = R11_p0*gradU11 + R12_p0*gradU21 + R13_p0*gradU31
+      P12_1 = R11_p0*gradU12 + R12_p0*gradU22 + R13_p0*gradU32
+      P13_1 = R11_p0*gradU13 + R12_p0*gradU23 + R13_p0*gradU33
+      P21_1 = R12_p0*gradU11 + R22_p0*gradU21 + R23_p0*gradU31
+      P22_1 = R12_p0*gradU12 + R22_p0*gradU22 + R23_p0*gradU32
+      P23_1 = R12_p0*gradU13 + R22_p0*gradU23 + R23_p0*gradU33
+      P31_1 = R13_p0*gradU11 + R23_p0*gradU21 + R33_p0*gradU31
+      P32_1 = R13_p0*gradU12 + R23_p0*gradU22 + R33_p0*gradU32
+      P33_1 = R13_p0*gradU13 + R23_p0*gradU23 + R33_p0*gradU33
+
+      P11 = -( P11_1 + P11_1 ) * actv
+      P12 = -( P12_1 + P21_1 ) * actv
+      P13 = -( P13_1 + P31_1 ) * actv
+      P22 = -( P22_1 + P22_1 ) * actv
+      P23 = -( P23_1 + P32_1 ) * actv
+      P33 = -( P33_1 + P33_1 ) * actv
+
+      ! (2) 散逸項
+      ! 48 flop
+      E11 = 2 * nu * ( gradF11*gradF11 + gradF21*gradF21 + gradF31*gradF31 ) * actv
+      E12 = 2 * nu * ( gradF11*gradF12 + gradF21*gradF22 + gradF31*gradF32 ) * actv
+      E13 = 2 * nu * ( gradF11*gradF13 + gradF21*gradF23 + gradF31*gradF33 ) * actv
+      E22 = 2 * nu * ( gradF12*gradF12 + gradF22*gradF22 + gradF32*gradF32 ) * actv
+      E23 = 2 * nu * ( gradF12*gradF13 + gradF22*gradF23 + gradF32*gradF33 ) * actv
+      E33 = 2 * nu * ( gradF13*gradF13 + gradF23*gradF23 + gradF33*gradF33 ) * actv
+
+      ! (3) 乱流拡散項
       ! 84 flop
-      T11 = - ( v1p * rx * (R11_e1 - R11_w1) &
-              + v2p * ry * (R11_n1 - R11_s1) &
-              + v3p * rz * (R11_t1 - R11_b1) &
+      T11 = - ( Uf_p0 * rx * (R11_e1 - R11_w1) &
+              + Vf_p0 * ry * (R11_n1 - R11_s1) &
+              + Wf_p0 * rz * (R11_t1 - R11_b1) &
               ) * actv
-
-      T12 = - ( v1p * rx * (R12_e1 - R12_w1) &
-              + v2p * ry * (R12_n1 - R12_s1) &
-              + v3p * rz * (R12_t1 - R12_b1) &
+      T12 = - ( Uf_p0 * rx * (R12_e1 - R12_w1) &
+              + Vf_p0 * ry * (R12_n1 - R12_s1) &
+              + Wf_p0 * rz * (R12_t1 - R12_b1) &
               ) * actv
-
-      T13 = - ( v1p * rx * (R13_e1 - R13_w1) &
-              + v2p * ry * (R13_n1 - R13_s1) &
-              + v3p * rz * (R13_t1 - R13_b1) &
+      T13 = - ( Uf_p0 * rx * (R13_e1 - R13_w1) &
+              + Vf_p0 * ry * (R13_n1 - R13_s1) &
+              + Wf_p0 * rz * (R13_t1 - R13_b1) &
               ) * actv
-
-      T22 = - ( v1p * rx * (R22_e1 - R22_w1) &
-              + v2p * ry * (R22_n1 - R22_s1) &
-              + v3p * rz * (R22_t1 - R22_b1) &
+      T22 = - ( Uf_p0 * rx * (R22_e1 - R22_w1) &
+              + Vf_p0 * ry * (R22_n1 - R22_s1) &
+              + Wf_p0 * rz * (R22_t1 - R22_b1) &
               ) * actv
-
-      T23 = - ( v1p * rx * (R23_e1 - R23_w1) &
-              + v2p * ry * (R23_n1 - R23_s1) &
-              + v3p * rz * (R23_t1 - R23_b1) &
+      T23 = - ( Uf_p0 * rx * (R23_e1 - R23_w1) &
+              + Vf_p0 * ry * (R23_n1 - R23_s1) &
+              + Wf_p0 * rz * (R23_t1 - R23_b1) &
               ) * actv
-
-      T33 = - ( v1p * rx * (R33_e1 - R33_w1) &
-              + v2p * ry * (R33_n1 - R33_s1) &
-              + v3p * rz * (R33_t1 - R33_b1) &
+      T33 = - ( Uf_p0 * rx * (R33_e1 - R33_w1) &
+              + Vf_p0 * ry * (R33_n1 - R33_s1) &
+              + Wf_p0 * rz * (R33_t1 - R33_b1) &
               ) * actv
 
-      ! 乱流拡散項 (時間平均値)
-      ! 18 flop
-      T_ave(1, i, j, k) = val1 * T_ave(1, i, j, k) + val2 * T11
-      T_ave(2, i, j, k) = val1 * T_ave(2, i, j, k) + val2 * T12
-      T_ave(3, i, j, k) = val1 * T_ave(3, i, j, k) + val2 * T13
-      T_ave(4, i, j, k) = val1 * T_ave(4, i, j, k) + val2 * T22
-      T_ave(5, i, j, k) = val1 * T_ave(5, i, j, k) + val2 * T23
-      T_ave(6, i, j, k) = val1 * T_ave(6, i, j, k) + val2 * T33
-
-end do
-end do
-end do
-!$OMP END DO
-!$OMP END PARALLEL
-
-return
-end subroutine calc_turb_transport_rate
-!> ********************************************************************
-
-
-
-
-
-!> ********************************************************************
-!! @brief 速度圧力勾配相関項の計算
-!! @param [out]  PI_ave  散逸項 (時間平均値)
-!! @param [in]   sz      配列長
-!! @param [in]   dh      格子幅
-!! @param [in]   g       ガイドセル長
-!! @param [in]   v       セルセンター速度ベクトル
-!! @param [in]   v_ave   セルセンター時間平均速度ベクトル
-!! @param [in]   p       セルセンター圧力
-!! @param [in]   p_ave   セルセンター時間平均圧力
-!! @param [in]   bp      BCindex P
-!! @param [in]   nadd    加算回数
-!! @param [out]  flop    flop count
-!<
-subroutine calc_vel_pregrad_term (PI_ave, sz, dh, g, v, v_ave, p, p_ave, bp, nadd, flop)
-implicit none
-include 'ffv_f_params.h'
-integer                                                   ::  i, j, k, ix, jx, kx, g, idx
-integer, dimension(3)                                     ::  sz
-real, dimension(3)                                        ::  dh
-real                                                      ::  actv, rx, ry, rz
-real                                                      ::  v1p, v2p, v3p
-real                                                      ::  p0, pw1, pe1, ps1, pn1, pb1, pt1
-real                                                      ::  PI11, PI12, PI13, PI22, PI23, PI33
-real                                                      ::  ugradp11, ugradp12, ugradp13
-real                                                      ::  ugradp21, ugradp22, ugradp23
-real                                                      ::  ugradp31, ugradp32, ugradp33
-real                                                      ::  ugradpt11, ugradpt12, ugradpt13
-real                                                      ::  ugradpt21, ugradpt22, ugradpt23
-real                                                      ::  ugradpt31, ugradpt32, ugradpt33
-real, dimension(6, 1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  PI_ave
-real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  v, v_ave
-real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g)    ::  p, p_ave
-real                                                      ::  nadd, val1, val2
-integer, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  bp
-double precision                                          ::  flop
-
-ix = sz(1)
-jx = sz(2)
-kx = sz(3)
-
-! 27 flop
-! rx = 1.0 / (2.0*dh(1))
-! ry = 1.0 / (2.0*dh(2))
-! rz = 1.0 / (2.0*dh(3))
-rx = 1.0 / (1.0*dh(1))
-ry = 1.0 / (1.0*dh(2))
-rz = 1.0 / (1.0*dh(3))
-
-! 9 flop
-val2 = 1.0/nadd
-val1 = 1.0 - val2
-
-flop = flop + dble(ix)*dble(jx)*dble(kx)*89.0d0 + 36.0d0
-
-!$OMP PARALLEL &
-!$OMP PRIVATE(idx, actv) &
-!$OMP PRIVATE(v1p, v2p, v3p) &
-!$OMP PRIVATE(p0, pw1, pe1, ps1, pn1, pb1, pt1) &
-!$OMP PRIVATE(PI11, PI12, PI13, PI22, PI23, PI33) &
-!$OMP PRIVATE(ugradp11, ugradp12, ugradp13) &
-!$OMP PRIVATE(ugradp21, ugradp22, ugradp23) &
-!$OMP PRIVATE(ugradp31, ugradp32, ugradp33) &
-!$OMP PRIVATE(ugradpt11, ugradpt12, ugradpt13) &
-!$OMP PRIVATE(ugradpt21, ugradpt22, ugradpt23) &
-!$OMP PRIVATE(ugradpt31, ugradpt32, ugradpt33) &
-!$OMP FIRSTPRIVATE(ix, jx, kx, rx, ry, rz)
-!$OMP DO SCHEDULE(static)
-
-do k = 1, kx
-do j = 1, jx
-do i = 1, ix
-
-      ! セル状態 (0-solid / 1-fluid) > 1 flop
-      actv= real(ibits(bp(i,j,k), State, 1))
-
-      ! 変動速度ベクトル
-      ! 3 flop
-      v1p = v(i, j, k, 1) - v_ave(i, j, k, 1)
-      v2p = v(i, j, k, 2) - v_ave(i, j, k, 2)
-      v3p = v(i, j, k, 3) - v_ave(i, j, k, 3)
-
-      ! 変動圧力
-      ! 7 flop
-      p0  = p(i,   j,   k  ) - p_ave(i,   j,   k  )
-      pw1 = p(i-1, j,   k  ) - p_ave(i-1, j,   k  )
-      pe1 = p(i+1, j,   k  ) - p_ave(i+1, j,   k  )
-      ps1 = p(i,   j-1, k  ) - p_ave(i,   j-1, k  )
-      pn1 = p(i,   j+1, k  ) - p_ave(i,   j+1, k  )
-      pb1 = p(i,   j,   k-1) - p_ave(i,   j,   k-1)
-      pt1 = p(i,   j,   k+1) - p_ave(i,   j,   k+1)
-
-      ! 壁面の場合の参照速度の修正 (Neumann 条件)
-      if ( ibits(bp(i, j, k), bc_n_W, 1) == 0 ) pw1 = p0
-      if ( ibits(bp(i, j, k), bc_n_E, 1) == 0 ) pe1 = p0
-      if ( ibits(bp(i, j, k), bc_n_S, 1) == 0 ) ps1 = p0
-      if ( ibits(bp(i, j, k), bc_n_N, 1) == 0 ) pn1 = p0
-      if ( ibits(bp(i, j, k), bc_n_B, 1) == 0 ) pb1 = p0
-      if ( ibits(bp(i, j, k), bc_n_T, 1) == 0 ) pt1 = p0
-
-      ! 壁面の場合の参照速度の修正 (Dirichlet 条件)
-      if ( ibits(bp(i, j, k), bc_d_W, 1) == 0 ) pw1 = -p0
-      if ( ibits(bp(i, j, k), bc_d_E, 1) == 0 ) pe1 = -p0
-      if ( ibits(bp(i, j, k), bc_d_S, 1) == 0 ) ps1 = -p0
-      if ( ibits(bp(i, j, k), bc_d_N, 1) == 0 ) pn1 = -p0
-      if ( ibits(bp(i, j, k), bc_d_B, 1) == 0 ) pb1 = -p0
-      if ( ibits(bp(i, j, k), bc_d_T, 1) == 0 ) pt1 = -p0
-
-      ! 速度圧力勾配相関項 (第一項)
-      ! 36 flop
-!      ugradp11 = v1p * rx * ( pe1 - pw1 ) * actv
-!      ugradp12 = v1p * ry * ( pn1 - ps1 ) * actv
-!      ugradp13 = v1p * rz * ( pt1 - pb1 ) * actv
-!      ugradp21 = v2p * rx * ( pe1 - pw1 ) * actv
-!      ugradp22 = v2p * ry * ( pn1 - ps1 ) * actv
-!      ugradp23 = v2p * rz * ( pt1 - pb1 ) * actv
-!      ugradp31 = v3p * rx * ( pe1 - pw1 ) * actv
-!      ugradp32 = v3p * ry * ( pn1 - ps1 ) * actv
-!      ugradp33 = v3p * rz * ( pt1 - pb1 ) * actv
-      ugradp11 = v1p * rx * ( pe1 - p0 ) * actv
-      ugradp12 = v1p * ry * ( pn1 - p0 ) * actv
-      ugradp13 = v1p * rz * ( pt1 - p0 ) * actv
-      ugradp21 = v2p * rx * ( pe1 - p0 ) * actv
-      ugradp22 = v2p * ry * ( pn1 - p0 ) * actv
-      ugradp23 = v2p * rz * ( pt1 - p0 ) * actv
-      ugradp31 = v3p * rx * ( pe1 - p0 ) * actv
-      ugradp32 = v3p * ry * ( pn1 - p0 ) * actv
-      ugradp33 = v3p * rz * ( pt1 - p0 ) * actv
-
-      ! 第一項の転置
-      ugradpt11 = ugradp11
-      ugradpt12 = ugradp21
-      ugradpt13 = ugradp31
-      ugradpt21 = ugradp12
-      ugradpt22 = ugradp22
-      ugradpt23 = ugradp32
-      ugradpt31 = ugradp13
-      ugradpt32 = ugradp23
-      ugradpt33 = ugradp33
-
-      ! 速度圧力勾配相関項
-      ! 24 flop
-      PI11 = -( ugradp11 + ugradpt11 ) * actv
-      PI12 = -( ugradp12 + ugradpt12 ) * actv
-      PI13 = -( ugradp13 + ugradpt13 ) * actv
-      PI22 = -( ugradp22 + ugradpt22 ) * actv
-      PI23 = -( ugradp23 + ugradpt23 ) * actv
-      PI33 = -( ugradp33 + ugradpt33 ) * actv
-
-      ! 速度圧力勾配相関項 (時間平均値)
-      ! 18 flop
-      PI_ave(1, i, j, k) = val1 * PI_ave(1, i, j, k) + val2 * PI11
-      PI_ave(2, i, j, k) = val1 * PI_ave(2, i, j, k) + val2 * PI12
-      PI_ave(3, i, j, k) = val1 * PI_ave(3, i, j, k) + val2 * PI13
-      PI_ave(4, i, j, k) = val1 * PI_ave(4, i, j, k) + val2 * PI22
-      PI_ave(5, i, j, k) = val1 * PI_ave(5, i, j, k) + val2 * PI23
-      PI_ave(6, i, j, k) = val1 * PI_ave(6, i, j, k) + val2 * PI33
+      ! (4) 速度圧力勾配相関項 変動圧力 > 4 flop
+      p0  = p(i,   j,   k  ) - ap(i,   j,   k  )
+      pe1 = p(i+1, j,   k  ) - ap(i+1, j,   k  )
+      pn1 = p(i,   j+1, k  ) - ap(i,   j+1, k  )
+      pt1 = p(i,   j,   k+1) - ap(i,   j,   k+1)
+
+      ! 壁面の場合の参照圧力の修正 (Neumann 条件, Dirichlet 条件)
+      if ( ibits(idx, bc_n_E, 1) == 0 ) pe1 = p0
+      if ( ibits(idx, bc_n_N, 1) == 0 ) pn1 = p0
+      if ( ibits(idx, bc_n_T, 1) == 0 ) pt1 = p0
+
+      if ( ibits(idx, bc_d_E, 1) == 0 ) pe1 = -p0
+      if ( ibits(idx, bc_d_N, 1) == 0 ) pn1 = -p0
+      if ( ibits(idx, bc_d_T, 1) == 0 ) pt1 = -p0
+
+      ! 36 + 24 flop
+      ugradp11 = Uf_p0 * rpx * ( pe1 - p0 ) * actv
+      ugradp12 = Uf_p0 * rpy * ( pn1 - p0 ) * actv
+      ugradp13 = Uf_p0 * rpz * ( pt1 - p0 ) * actv
+      ugradp21 = Vf_p0 * rpx * ( pe1 - p0 ) * actv
+      ugradp22 = Vf_p0 * rpy * ( pn1 - p0 ) * actv
+      ugradp23 = Vf_p0 * rpz * ( pt1 - p0 ) * actv
+      ugradp31 = Wf_p0 * rpx * ( pe1 - p0 ) * actv
+      ugradp32 = Wf_p0 * rpy * ( pn1 - p0 ) * actv
+      ugradp33 = Wf_p0 * rpz * ( pt1 - p0 ) * actv
+
+      PI11 = -( ugradp11 + ugradp11 ) * actv
+      PI12 = -( ugradp12 + ugradp21 ) * actv
+      PI13 = -( ugradp13 + ugradp31 ) * actv
+      PI22 = -( ugradp22 + ugradp22 ) * actv
+      PI23 = -( ugradp23 + ugradp32 ) * actv
+      PI33 = -( ugradp33 + ugradp33 ) * actv
+
+      ! 時間平均値
+      ! 90 flop
+      R_ave(1, i, j, k) = R_ave(1, i, j, k) + val2 * ( R11_p0 - R_ave(1, i, j, k) )
+      R_ave(2, i, j, k) = R_ave(2, i, j, k) + val2 * ( R12_p0 - R_ave(2, i, j, k) )
+      R_ave(3, i, j, k) = R_ave(3, i, j, k) + val2 * ( R13_p0 - R_ave(3, i, j, k) )
+      R_ave(4, i, j, k) = R_ave(4, i, j, k) + val2 * ( R22_p0 - R_ave(4, i, j, k) )
+      R_ave(5, i, j, k) = R_ave(5, i, j, k) + val2 * ( R23_p0 - R_ave(5, i, j, k) )
+      R_ave(6, i, j, k) = R_ave(6, i, j, k) + val2 * ( R33_p0 - R_ave(6, i, j, k) )
+
+      P_ave(1, i, j, k) = P_ave(1, i, j, k) + val2 * ( P11 - P_ave(1, i, j, k) )
+      P_ave(2, i, j, k) = P_ave(2, i, j, k) + val2 * ( P12 - P_ave(2, i, j, k) )
+      P_ave(3, i, j, k) = P_ave(3, i, j, k) + val2 * ( P13 - P_ave(3, i, j, k) )
+      P_ave(4, i, j, k) = P_ave(4, i, j, k) + val2 * ( P22 - P_ave(4, i, j, k) )
+      P_ave(5, i, j, k) = P_ave(5, i, j, k) + val2 * ( P23 - P_ave(5, i, j, k) )
+      P_ave(6, i, j, k) = P_ave(6, i, j, k) + val2 * ( P33 - P_ave(6, i, j, k) )
+
+      E_ave(1, i, j, k) = E_ave(1, i, j, k) + val2 * ( E11 - E_ave(1, i, j, k) )
+      E_ave(2, i, j, k) = E_ave(2, i, j, k) + val2 * ( E12 - E_ave(2, i, j, k) )
+      E_ave(3, i, j, k) = E_ave(3, i, j, k) + val2 * ( E13 - E_ave(3, i, j, k) )
+      E_ave(4, i, j, k) = E_ave(4, i, j, k) + val2 * ( E22 - E_ave(4, i, j, k) )
+      E_ave(5, i, j, k) = E_ave(5, i, j, k) + val2 * ( E23 - E_ave(5, i, j, k) )
+      E_ave(6, i, j, k) = E_ave(6, i, j, k) + val2 * ( E33 - E_ave(6, i, j, k) )
+
+      T_ave(1, i, j, k) = T_ave(1, i, j, k) + val2 * ( T11 - T_ave(1, i, j, k) )
+      T_ave(2, i, j, k) = T_ave(2, i, j, k) + val2 * ( T12 - T_ave(2, i, j, k) )
+      T_ave(3, i, j, k) = T_ave(3, i, j, k) + val2 * ( T13 - T_ave(3, i, j, k) )
+      T_ave(4, i, j, k) = T_ave(4, i, j, k) + val2 * ( T22 - T_ave(4, i, j, k) )
+      T_ave(5, i, j, k) = T_ave(5, i, j, k) + val2 * ( T23 - T_ave(5, i, j, k) )
+      T_ave(6, i, j, k) = T_ave(6, i, j, k) + val2 * ( T33 - T_ave(6, i, j, k) )
+
+      PI_ave(1, i, j, k) = PI_ave(1, i, j, k) + val2 * ( PI11 - PI_ave(1, i, j, k) )
+      PI_ave(2, i, j, k) = PI_ave(2, i, j, k) + val2 * ( PI12 - PI_ave(2, i, j, k) )
+      PI_ave(3, i, j, k) = PI_ave(3, i, j, k) + val2 * ( PI13 - PI_ave(3, i, j, k) )
+      PI_ave(4, i, j, k) = PI_ave(4, i, j, k) + val2 * ( PI22 - PI_ave(4, i, j, k) )
+      PI_ave(5, i, j, k) = PI_ave(5, i, j, k) + val2 * ( PI23 - PI_ave(5, i, j, k) )
+      PI_ave(6, i, j, k) = PI_ave(6, i, j, k) + val2 * ( PI33 - PI_ave(6, i, j, k) )
 
 end do
 end do
@@ -2422,7 +2094,7 @@ end do
 !$OMP END PARALLEL
 
 return
-end subroutine calc_vel_pregrad_term
+end subroutine calc_turb_budget
 !> ********************************************************************
 
 
@@ -2433,8 +2105,8 @@ end subroutine calc_vel_pregrad_term
 subroutine averaging_xz_plane(vmean, rmsmean, Rmean, Pmean, Emean, Tmean, PImean, sz, g, v_ave, rms_ave, R_ave, P_ave, E_ave, T_ave, PI_ave)
 integer, dimension(3)                                     :: sz
 integer                                                   :: ix, jx, kx, i, j, k, g, d
-real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) :: v_ave, rms_ave
-real, dimension(6, 1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) :: R_ave, P_ave, E_ave, T_ave, PI_ave
+real(STORE_KIND), dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) :: v_ave, rms_ave
+real(STORE_KIND), dimension(6, 1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) :: R_ave, P_ave, E_ave, T_ave, PI_ave
 real, dimension(3, 1:sz(2))                               :: vmean, rmsmean
 real, dimension(6, 1:sz(2))                               :: Rmean, Pmean, Emean, Tmean, PImean 
 
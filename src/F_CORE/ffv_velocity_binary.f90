@@ -20,11 +20,15 @@
 !! @author aics
 !<
 
+#include "ffv_f_store.h"
+
 !> ********************************************************************
 !! @brief 対流項と粘性項の計算
 !! @param [out] wv        疑似ベクトルの空間項
 !! @param [in]  sz        配列長
 !! @param [in]  g         ガイドセル長
+!! @param [in]  st        ループの開始インデクス
+!! @param [in]  ed        ループの終了インデクス
 !! @param [in]  dh        格子幅
 !! @param [in]  c_scheme  対流項スキームのモード（1-UWD, 3-MUSCL）
 !! @param [in]  v00       参照速度
@@ -36,11 +40,11 @@
 !! @param [in]  vcs_coef  粘性項の係数（粘性項を計算しない場合には0.0）
 !! @param [out] flop      浮動小数点演算数
 !<
-subroutine pvec_muscl (wv, sz, g, dh, c_scheme, v00, rei, v, vf, bv, bid, vcs_coef, flop)
+subroutine pvec_muscl (wv, sz, g, st, ed, dh, c_scheme, v00, rei, v, vf, bv, bid, vcs_coef, flop)
 implicit none
 include 'ffv_f_params.h'
 integer                                                   ::  i, j, k, ix, jx, kx, g, c_scheme, bvx, bix
-integer, dimension(3)                                     ::  sz
+integer, dimension(3)                                     ::  sz, st, ed
 double precision                                          ::  flop
 real                                                      ::  b_e1, b_w1, b_n1, b_s1, b_t1, b_b1
 real                                                      ::  b_e2, b_w2, b_n2, b_s2, b_t2, b_b2, b_p
@@ -106,7 +110,7 @@ cm2 = 1.0 + ck
 
 ! Total : 36 + 24 + 3 + (14 + 78 * 3 + 12) + 69 + 12 = 888
 
-flop = flop + dble(ix)*dble(jx)*dble(kx)*888.0d0 + 36.0d0
+flop = flop + dble(ed(1)-st(1)+1)*dble(ed(2)-st(2)+1)*dble(ed(3)-st(3)+1)*888.0d0 + 36.0d0
 
 
 !$OMP PARALLEL &
@@ -127,9 +131,9 @@ flop = flop + dble(ix)*dble(jx)*dble(kx)*888.0d0 + 36.0d0
 
 !$OMP DO SCHEDULE(static) COLLAPSE(2)
 
-do k=1,kx
-do j=1,jx
-do i=1,ix
+do k=st(3),ed(3)
+do j=st(2),ed(2)
+do i=st(1),ed(1)
 cnv_u = 0.0
 cnv_v = 0.0
 cnv_w = 0.0
@@ -1381,6 +1385,8 @@ end subroutine pvec_muscl_les
 !! @param [out] div  div {u^{n+1}}
 !! @param [in]  sz   配列長
 !! @param [in]  g    ガイドセル長
+!! @param [in]  st   ループの開始インデクス
+!! @param [in]  ed   ループの終了インデクス
 !! @param [in]  dt   時間積分幅
 !! @param [in]  dh   格子幅
 !! @param [in]  vc   セルセンター疑似速度ベクトル
@@ -1391,11 +1397,11 @@ end subroutine pvec_muscl_les
 !! @note
 !!    - actvのマスクはSPEC_VEL/OUTFLOWの参照セルをマスクしないようにbvを使う
 !<
-subroutine update_vec (v, vf, div, sz, g, dt, dh, vc, p, bp, bv, flop)
+subroutine update_vec (v, vf, div, sz, g, st, ed, dt, dh, vc, p, bp, bv, flop)
 implicit none
 include 'ffv_f_params.h'
 integer                                                   ::  i, j, k, ix, jx, kx, g, bpx, bvx
-integer, dimension(3)                                     ::  sz
+integer, dimension(3)                                     ::  sz, st, ed
 double precision                                          ::  flop
 real                                                      ::  dt, actv, rx, ry, rz
 real                                                      ::  pc, px, py, pz, pxw, pxe, pys, pyn, pzb, pzt
@@ -1420,7 +1426,7 @@ ry = 1.0 / dh(2)
 rz = 1.0 / dh(3)
 
 
-flop = flop + dble(ix)*dble(jx)*dble(kx)*84.0 + 24.0d0
+flop = flop + dble(ed(1)-st(1)+1)*dble(ed(2)-st(2)+1)*dble(ed(3)-st(3)+1)*84.0 + 24.0d0
 
 
 !$OMP PARALLEL &
@@ -1436,9 +1442,9 @@ flop = flop + dble(ix)*dble(jx)*dble(kx)*84.0 + 24.0d0
 !$OMP FIRSTPRIVATE(ix, jx, kx, dt, rx, ry, rz)
 
 !$OMP DO SCHEDULE(static) COLLAPSE(2)
-do k=1,kx
-do j=1,jx
-do i=1,ix
+do k=st(3),ed(3)
+do j=st(2),ed(2)
+do i=st(1),ed(1)
 bpx = bp(i,j,k)
 bvx = bv(i,j,k)
 actv = real(ibits(bvx, State,  1))
@@ -1950,17 +1956,19 @@ end subroutine divergence_cc
 !! @param [in,out] vc   対流項と粘性項の和 > 疑似ベクトル
 !! @param [in]     sz   配列長
 !! @param [in]     g    ガイドセル長
+!! @param [in]     st   ループの開始インデクス
+!! @param [in]     ed   ループの終了インデクス
 !! @param [in]     dt   時間積分幅
 !! @param [in]     v    速度ベクトル（n-step, collocated）
 !! @param [in]     bd   BCindex B
 !! @param [in,out] flop 浮動小数点演算数
 !! @note ここのマスクはIDのこと，VSPEC, OUTFLOWの増分をキャンセルするため
 !<
-subroutine euler_explicit (vc, sz, g, dt, v, bd, flop)
+subroutine euler_explicit (vc, sz, g, st, ed, dt, v, bd, flop)
 implicit none
 include 'ffv_f_params.h'
 integer                                                   ::  i, j, k, ix, jx, kx, g
-integer, dimension(3)                                     ::  sz
+integer, dimension(3)                                     ::  sz, st, ed
 double precision                                          ::  flop
 real                                                      ::  actv, dt
 real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  vc, v
@@ -1970,16 +1978,16 @@ ix = sz(1)
 jx = sz(2)
 kx = sz(3)
 
-flop = flop + dble(ix)*dble(jx)*dble(kx)*8.0d0
+flop = flop + dble(ed(1)-st(1)+1)*dble(ed(2)-st(2)+1)*dble(ed(3)-st(3)+1)*8.0d0
 
 !$OMP PARALLEL &
 !$OMP PRIVATE(actv) &
 !$OMP FIRSTPRIVATE(ix, jx, kx, dt)
 
 !$OMP DO SCHEDULE(static) COLLAPSE(2)
-do k=1,kx
-do j=1,jx
-do i=1,ix
+do k=st(3),ed(3)
+do j=st(2),ed(2)
+do i=st(1),ed(1)
 actv = dt * real(ibits(bd(i,j,k), State, 1))
 
 vc(i,j,k,1) = v(i,j,k,1) + vc(i,j,k,1)* actv
@@ -2029,7 +2037,7 @@ real                                                        ::  d1, d2, ddd, c1,
 real                                                        ::  fs, aaa, Vmag, dis, tw, up1
 real                                                        ::  u_ref, v_ref, w_ref, u1, u2, u3
 real                                                        ::  dx, dy, dz, rx, ry, rz
-real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g)      ::  vt
+real(STORE_KIND), dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g) ::  vt
 real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3)   ::  v
 real, dimension(0:3)                                        ::  v00
 integer, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g)   ::  bx
@@ -2148,6 +2156,8 @@ w_ref = v00(3)
 !! @param[out] vc 疑似ベクトル
 !! @param sz 配列長
 !! @param g ガイドセル長
+!! @param st ループの開始インデクス
+!! @param ed ループの終了インデクス
 !! @param dt 時間積分幅
 !! @param v 速度ベクトル（n-step, collocated）
 !! @param ab 前ステップの対流項（＋粘性項）の計算値
@@ -2156,11 +2166,11 @@ w_ref = v00(3)
 !! @param[out] flop
 !! @note NOCHECK
 !<
-    subroutine ab2 (vc, sz, g, dt, v, ab, bd, v00, flop)
+    subroutine ab2 (vc, sz, g, st, ed, dt, v, ab, bd, v00, flop)
     implicit none
     include 'ffv_f_params.h'
     integer                                                   ::  i, j, k, ix, jx, kx, g
-    integer, dimension(3)                                     ::  sz
+    integer, dimension(3)                                     ::  sz, st, ed
     double precision                                          ::  flop
     real                                                      ::  actv, dt, ab_u, ab_v, ab_w, u_ref, v_ref, w_ref
     real, dimension(1-g:sz(1)+g, 1-g:sz(2)+g, 1-g:sz(3)+g, 3) ::  vc, v, ab
@@ -2173,11 +2183,11 @@ w_ref = v00(3)
     u_ref = v00(1)
     v_ref = v00(2)
     w_ref = v00(3)
-    flop = flop + dble(ix*jx*kx) * 27.0d0
+    flop = flop + dble(ed(1)-st(1)+1)*dble(ed(2)-st(2)+1)*dble(ed(3)-st(3)+1) * 27.0d0
     
-    do k=1,kx
-    do j=1,jx
-    do i=1,ix
+    do k=st(3),ed(3)
+    do j=st(2),ed(2)
+    do i=st(1),ed(1)
       actv = real(ibits(bd(i,j,k), State, 1))
       
       ab_u = ab(i,j,k,1)
@@ -2204,6 +2214,8 @@ w_ref = v00(3)
 !! @param [out] wv        疑似ベクトルの空間項 u \frac{\partial u}{\partial x}
 !! @param [in]  sz        配列長
 !! @param [in]  g         ガイドセル長
+!! @param [in]  st        ループの開始インデクス
+!! @param [in]  ed        ループの終了インデクス
 !! @param [in]  dh        格子幅
 !! @param [in]  c_scheme  対流項スキームのモード（2-Central_2nd, 4-Central_4th）
 !! @param [in]  v00       参照速度
@@ -2215,11 +2227,11 @@ w_ref = v00(3)
 !! @param [in]  vcs_coef  粘性項の係数（粘性項を計算しない場合には0.0）
 !! @param [out] flop      浮動小数点演算数
 !<
-subroutine pvec_central (wv, sz, g, dh, c_scheme, v00, rei, v, vf, bv, bid, vcs_coef, flop)
+subroutine pvec_central (wv, sz, g, st, ed, dh, c_scheme, v00, rei, v, vf, bv, bid, vcs_coef, flop)
 implicit none
 include 'ffv_f_params.h'
 integer                                                   ::  i, j, k, ix, jx, kx, g, c_scheme, bvx, bix
-integer, dimension(3)                                     ::  sz
+integer, dimension(3)                                     ::  sz, st, ed
 double precision                                          ::  flop
 real                                                      ::  b_e1, b_w1, b_n1, b_s1, b_t1, b_b1
 real                                                      ::  b_e2, b_w2, b_n2, b_s2, b_t2, b_b2, b_p
@@ -2279,7 +2291,7 @@ v_ref2 = 2.0*v_ref
 w_ref2 = 2.0*w_ref
 
 ! 24 + 3 + 3 * 106 + 21 + 9 = 375
-flop = flop + dble(ix)*dble(jx)*dble(kx)*375.0d0 + 46.0d0
+flop = flop + dble(ed(1)-st(1)+1)*dble(ed(2)-st(2)+1)*dble(ed(3)-st(3)+1)*375.0d0 + 46.0d0
 
 
 !$OMP PARALLEL &
@@ -2299,9 +2311,9 @@ flop = flop + dble(ix)*dble(jx)*dble(kx)*375.0d0 + 46.0d0
 
 !$OMP DO SCHEDULE(static) COLLAPSE(2)
 
-do k=1,kx
-do j=1,jx
-do i=1,ix
+do k=st(3),ed(3)
+do j=st(2),ed(2)
+do i=st(1),ed(1)
 cnv_u = 0.0
 cnv_v = 0.0
 cnv_w = 0.0
@@ -49,6 +49,7 @@ protected:
   Vec3r pch;       ///< セル幅
   Vec3r org;       ///< 計算領域の基点
   Vec3r angle;     ///< 変換の回転角度
+  Vec3r rot[3];    ///< 回転行列の行ベクトル getAngle()で設定
   
   // 形状パラメータ
   int smode;         ///< 形状モード
@@ -63,6 +64,7 @@ protected:
   Vec3r dir;         ///< 矩形の方向規定の参照ベクトル
   Vec3r box_min;     ///< Bounding boxの最小値
   Vec3r box_max;     ///< Bounding boxの最大値
+  REAL_TYPE tol;     ///< classifySphere()の判定余裕（丸め誤差分）
   
 public:
   /** デフォルトコンストラクタ */
@@ -74,6 +76,7 @@ public:
     height = 0.0;
     R1 = 0.0;
     R2 = 0.0;
+    tol = 0.0;
   }
   
   /** コンストラクタ
@@ -98,6 +101,14 @@ public:
     this->org.y    = org[1];
     this->org.z    = org[2];
     this->division = div;
+    smode = 0;
+    shape = 0;
+    depth = 0.0;
+    width = 0.0;
+    height = 0.0;
+    R1 = 0.0;
+    R2 = 0.0;
+    tol = 0.0;
   }
   
   /** デストラクタ */
@@ -209,7 +220,7 @@ protected:
    * @param [in] p    テスト点座標
    * @param [in] mode 変換モード
    * @return 内部のときに1を返す
-   * @note 186 flop
+   * @note 23 flop
    */
   inline int judgeCylider(const Vec3r p, bool mode=false)
   {
@@ -217,7 +228,7 @@ protected:
     
     if ( !mode )
     {
-      q = rotate(angle, p-center); // 181 flop
+      q = toLocal(p); // 18 flop
     }
     else
     {
@@ -241,7 +252,7 @@ protected:
    * @param [in] p    テスト点座標
    * @param [in] mode 変換モード
    * @return 内部のときに1を返す
-   * @note 183 flop
+   * @note 20 flop
    */
   inline int judgeRect(const Vec3r p, bool mode=false)
   {
@@ -249,7 +260,7 @@ protected:
     
     if ( !mode )
     {
-      q = rotate(angle, p-center); // 181 flop
+      q = toLocal(p); // 18 flop
     }
     else
     {
@@ -264,6 +275,69 @@ protected:
   }
   
   
+  /**
+   * @brief 球（中心c，半径rho）と形状の包含関係を判定する
+   * @param [in] c   中心座標
+   * @param [in] rho 半径
+   * @retval 1 - 球全体が内部, 0 - 球全体が外部, -1 - 境界をまたぐ
+   * @note 判定は保守的で，決まらない場合は-1を返す
+   */
+  inline int classifySphere(const Vec3r c, const REAL_TYPE rho)
+  {
+    Vec3r q = toLocal(c);
+    REAL_TYPE rr = rho + tol;
+    
+    if ( smode == mon_BOX )
+    {
+      REAL_TYPE ax = fabs(q.x);
+      REAL_TYPE ay = fabs(q.y);
+      
+      if ( q.z < -rr || q.z > depth+rr || ax > 0.5*width+rr || ay > 0.5*height+rr ) return 0;
+      if ( q.z >= rr && q.z <= depth-rr && ax <= 0.5*width-rr && ay <= 0.5*height-rr ) return 1;
+      return -1;
+    }
+    
+    REAL_TYPE r = sqrt(q.x*q.x + q.y*q.y);
+    
+    if ( shape == shape_cylinder )
+    {
+      if ( q.z < -rr || q.z > depth+rr ) return 0;
+    }
+    if ( r > R1+rr || r < R2-rr ) return 0;
+    
+    if ( shape == shape_cylinder )
+    {
+      if ( q.z < rr || q.z > depth-rr ) return -1;
+    }
+    
+    return ( r <= R1-rr && r >= R2+rr ) ? 1 : -1;
+  }
+  
+  
+  /**
+   * @brief サブセル範囲[lo, hi)の標本点のうち形状内部にある数
+   * @param [in]     b    セルの基点座標
+   * @param [in]     h    サブセル幅
+   * @param [in]     lo   サブセル範囲の開始
+   * @param [in]     hi   サブセル範囲の終了（含まない）
+   * @param [in,out] flop 浮動小数点演算数
+   * @note 標本点の外接球で内外が決まれば打ち切り，境界をまたぐ範囲だけを8分割する
+   */
+  unsigned long countSubCell(const Vec3r b, const Vec3r h, const int lo[3], const int hi[3], double& flop);
+  
+  
+  /**
+   * @brief 形状の局所座標系へ変換する
+   * @param [in] p 座標
+   * @note rotate(angle, p-center)と同じ値, 18 flop
+   */
+  inline Vec3r toLocal(const Vec3r p)
+  {
+    Vec3r u = p - center;
+    return Vec3r( dot(rot[0], u), dot(rot[1], u), dot(rot[2], u) );
+  }
+  
+  
   /**
    * @brief 回転ベクトルp(alpha, beta, gamma)でベクトルuを回転する
    * @param [in] p 回転角度
@@ -662,8 +736,9 @@ public:
    * @param [in]     ed    終了インデクス
    * @param [in,out] vf    フラクション
    * @param [in,out] flop  浮動小数点演算数
+   * @note 結果はdivision^3点の標本化と同じ．形状境界をまたぐサブセルだけを適応的に細分化する
    */
-  void subdivision(const int st[], const int ed[], REAL_TYPE* vf, double& flop);
+  void subdivision(const int st[], const int ed[], STORE_TYPE* vf, double& flop);
   
   
   /**
@@ -673,7 +748,7 @@ public:
    * @param [in,out] vf    フラクション
    * @param [in,out] flop  浮動小数点演算数
    */
-  void vertex8(const int st[], const int ed[], REAL_TYPE* vf, double& flop);
+  void vertex8(const int st[], const int ed[], STORE_TYPE* vf, double& flop);
   
 };
 
@@ -22,6 +22,7 @@
  */
 
 #include "DomainInfo.h"
+#include "HaloComm.h"
 #include "FB_Define.h"
 #include "Medium.h"
 #include "PolyProperty.h"
@@ -61,6 +62,14 @@ private:
   
   KindFill* fill_table;
   
+  /** 三角形と線分の交点　quantizeCut()の作業用 */
+  typedef struct {
+    size_t m;  ///< セルのインデクス
+    int dir;   ///< 方向
+    int r;     ///< 量子化交点距離
+    int pid;   ///< polygon id
+  } CutHit;
+  
   
 public:
   int FillID;          ///< フィル媒質ID
@@ -120,12 +129,42 @@ private:
                          const int* Dsize=NULL);
   
   
+  // 未ペイントセルの連結成分によるフィル
+  unsigned long fillByComponent(int* bcd,
+                                const int* bid,
+                                const MediumList* mat,
+                                const int mode,
+                                unsigned long& n_comp);
+  
+  
   // 流体媒質のフィルをbid情報を元に実行
   unsigned long fillByMid(int* mid,
                           const int tgt_id,
                           const int* Dsize=NULL);
   
   
+  // bid情報によるフィルをフロンティアの幅優先探索で実行
+  unsigned long fillByBidFrontier(int* bcd,
+                                  const int* bid,
+                                  const MediumList* mat,
+                                  const int mode,
+                                  int& n_round);
+  
+  
+  // bid情報によるフィルの判定
+  int testFillBid(const int* bcd,
+                  const int* bid,
+                  const MediumList* mat,
+                  const int fill_mode,
+                  const int i,
+                  const int j,
+                  const int k) const;
+  
+  
+  // ランク境界をまたぐ連結成分のラベルを統合する
+  unsigned long mergeComponentLabel(long long* lbl, const int nc, int* cmed);
+  
+  
   // 未ペイントセルを周囲の交点IDの最頻値でフィル
   bool fillByModalCutID(int* bcd,
                         const int* bid,
@@ -332,17 +371,26 @@ private:
                          REAL_TYPE& pRetV);
   
   
+  // セルセンター間の線分と三角形の交点
+  int intersectCut(const Vec3r ray_o,
+                   const int dir,
+                   const Vec3r v0,
+                   const Vec3r v1,
+                   const Vec3r v2);
+  
+  
   // 交点情報をアップデート
-  unsigned updateCut(const Vec3r ray_o,
-                     const int dir,
-                     const Vec3r v0,
-                     const Vec3r v1,
-                     const Vec3r v2,
-                     long long& cut,
+  unsigned recordCut(long long& cut,
                      int& bid,
+                     const int dir,
+                     const int r,
                      const int pid);
   
   
+  // 三角形が横切るセルセンター間の線分の交点を求める
+  void rasterizeTriangle(const Vec3r* p, const int pid, vector<CutHit>& hit);
+  
+  
   
   
 public:
@@ -403,6 +451,10 @@ public:
                                  const int* Dsize=NULL);
   
   
+  // フィルパラメータを文字列にする
+  string getFillSignature() const;
+  
+  
   // フィルパラメータを取得
   void getFillParam(TextParser* tpCntl,
                     FILE* fp,
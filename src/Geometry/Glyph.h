@@ -118,6 +118,18 @@ public:
   void generateVertex(const Vec3i idx, const long long pos, const int dir, const int m_bid);
   
   
+  /**
+   * @brief グリフ作成のための頂点を生成し，指定位置に登録
+   * @param [in] idx    セルインデクス
+   * @param [in] pos    カット距離
+   * @param [in] dir    方向
+   * @param [in] m_bid  (i,j,k)の境界ID
+   * @param [in] m_poly 登録するポリゴンの先頭番号
+   * @note 登録位置が重ならなければスレッド並列に呼んでよい
+   */
+  void generateVertex(const Vec3i idx, const long long pos, const int dir, const int m_bid, const size_t m_poly);
+  
+  
   /**
    * @brief アスキー出力
    * @param [in] ofs 出力ストリーム
@@ -131,6 +143,15 @@ public:
    */
   void writeBinary(const string outFile);
   
+  
+  /**
+   * @brief 全ランクのポリゴンを1つのバイナリSTLファイルに出力
+   * @param [in] outFile 出力ファイル名
+   * @param [in] comm    コミュニケータ
+   * @note 全ランクで呼ぶこと
+   */
+  void writeBinaryShared(const string outFile, MPI_Comm comm=MPI_COMM_WORLD);
+  
 
   
   
@@ -140,8 +161,16 @@ private:
    * @brief グリフポリゴンの登録
    * @param [in] p      頂点座標
    * @param [in] m_bid  境界ID
+   * @param [in] m_poly 登録するポリゴンの先頭番号
+   */
+  void registerPolygon(const Vec3f p[8], const int m_bid, const size_t m_poly);
+  
+  
+  /**
+   * @brief バイナリSTLのファセット列をバッファに詰める
+   * @param [out] buf 出力バッファ (50byte x element)
    */
-  void registerPolygon(const Vec3f p[8], const int m_bid);
+  void packBinary(char* buf) const;
   
   
   /**
@@ -0,0 +1,140 @@
+#ifndef _GEOM_STL_SCATTER_H_
+#define _GEOM_STL_SCATTER_H_
+
+//##################################################################################
+//
+// FFV-C : Frontflow / violet Cartesian
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   StlScatter.h
+ * @brief  StlScatter class Header
+ * @author aics
+ */
+
+// 使用例
+//     StlScatter ss;
+//     ss.setDomain(originD, regionD, margin);
+//     if ( !ss.scatter("body.stl", "body_000003.stl") ) ... // rank0ロードに戻す
+//
+//   各ランクがバイナリSTLのn/P個の三角形を読み，三角形のbboxがかかるサブドメイン
+//   （マージン込み）へ1回のMPI_Alltoallvで配る．受け取った三角形はランクごとの
+//   バイナリSTLに書き出し，Polylibにはこのファイルを読ませる
+//   ASCII形式のSTLは扱わない（falseを返す）
+
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include "mpi.h"
+#include "FB_Define.h"
+
+using namespace std;
+
+
+class StlScatter {
+
+private:
+  int myRank;             ///< ランク番号
+  int numProc;            ///< ランク数
+  MPI_Comm comm;          ///< コミュニケータ
+
+  double margin[3];       ///< 配布判定のマージン
+  vector<double> box;     ///< 全ランクの配布範囲 [rank][min xyz, max xyz]
+
+  bool tensor;            ///< サブドメインがテンソル積の配置になっているか
+  vector<double> cut[3];  ///< 軸ごとのサブドメイン開始位置（昇順）
+  double cut_end[3];      ///< 軸ごとの終端
+  vector<int> grid;       ///< 開始位置の番号の組からランク番号（空きは-1）
+
+  unsigned long n_read;   ///< 読み込んだ三角形数（自ランク）
+  unsigned long n_send;   ///< 送った三角形数（重複を含む）
+  unsigned long n_recv;   ///< 受け取った三角形数
+
+
+public:
+  /** コンストラクタ */
+  StlScatter() {
+    myRank  = 0;
+    numProc = 1;
+    comm    = MPI_COMM_WORLD;
+    tensor  = false;
+    n_read  = 0;
+    n_send  = 0;
+    n_recv  = 0;
+
+    for (int i=0; i<3; i++)
+    {
+      margin[i]  = 0.0;
+      cut_end[i] = 0.0;
+    }
+  }
+
+  /**　デストラクタ */
+  ~StlScatter() {}
+
+
+public:
+
+  /**
+   * @brief 全ランクのサブドメイン範囲を集める
+   * @param [in] org    自ランクの基点（有次元）
+   * @param [in] reg    自ランクの領域サイズ（有次元）
+   * @param [in] mgn    配布判定のマージン（ガイドセル幅）
+   * @param [in] m_comm コミュニケータ
+   * @retval MPIのエラーの場合false
+   */
+  bool setDomain(const REAL_TYPE* org, const REAL_TYPE* reg, const REAL_TYPE* mgn, MPI_Comm m_comm=MPI_COMM_WORLD);
+
+
+  /**
+   * @brief バイナリSTLを分割して読み，三角形をサブドメインへ配る
+   * @param [in] infile  入力STLファイル
+   * @param [in] outfile 自ランクの三角形を書き出すファイル
+   * @retval 開けない，バイナリ形式でない，MPIのエラーの場合false（全ランクで同じ結果）
+   * @note 集団操作なので全ランクで呼ぶ
+   */
+  bool scatter(const char* infile, const char* outfile);
+
+
+  /** @brief 直前のscatter()で読んだ三角形数 */
+  unsigned long getRead() const
+  {
+    return n_read;
+  }
+
+
+  /** @brief 直前のscatter()で送った三角形数 */
+  unsigned long getSend() const
+  {
+    return n_send;
+  }
+
+
+  /** @brief 直前のscatter()で受け取った三角形数 */
+  unsigned long getRecv() const
+  {
+    return n_recv;
+  }
+
+
+private:
+
+  // 三角形のbboxがかかるランク
+  void findRanks(const float* v, vector<int>& dst) const;
+
+  // テンソル積配置の表を作る
+  bool makeGrid();
+
+};
+
+#endif // _GEOM_STL_SCATTER_H_
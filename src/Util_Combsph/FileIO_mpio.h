@@ -0,0 +1,109 @@
+#ifndef _FileIO_MPIO_H_
+#define _FileIO_MPIO_H_
+
+//##################################################################################
+//
+// FFV-C : Frontflow / violet Cartesian
+//
+// Copyright (c) 2007-2011 VCAD System Research Program, RIKEN.
+// All rights reserved.
+//
+// Copyright (c) 2011-2015 Institute of Industrial Science, The University of Tokyo.
+// All rights reserved.
+//
+// Copyright (c) 2012-2015 Advanced Institute for Computational Science, RIKEN.
+// All rights reserved.
+//
+//##################################################################################
+
+/**
+ * @file   FileIO_mpio.h
+ * @brief  FileIO_MPIO Class Header
+ * @author aics
+ */
+
+// FFVの共有ファイル出力（*.mpio, *.mpio.idx）の読み込み
+// 読み込みはFILE_IOのSharedFileクラスに任せる．comb.hとFB_Define.hを同時に読まないよう，
+// このヘッダにはFFVのヘッダを含めない
+
+#include <string>
+#include <vector>
+
+
+/**
+ * 共有ファイル読み込みクラス
+ */
+class FileIO_MPIO {
+
+private:
+  std::string m_data;      ///< データファイル名
+  std::string m_name;      ///< 変数名
+  unsigned m_step;         ///< ステップ
+  double m_time;           ///< 時刻
+  int m_gsize[3];          ///< 全体の要素数
+  int m_ncomp;             ///< 成分数
+  int m_dsize;             ///< 要素のバイト数
+  double m_org[3];         ///< 全体領域の基点
+  double m_pit[3];         ///< 格子幅
+  int m_comp;              ///< 圧縮モード
+  double m_tol;            ///< 非可逆圧縮の許容誤差
+  std::vector<int> m_zcut; ///< 圧縮ファイルの書き出しランクのz方向の境界（0から）
+
+public:
+  /** コンストラクタ */
+  FileIO_MPIO();
+
+  /**　デストラクタ */
+  ~FileIO_MPIO() {}
+
+
+  /**
+   * @brief インデクスファイルを開く
+   * @param [in] idxfile インデクスファイル名（*.mpio.idx）
+   * @retval 読めない場合，またはデータ型とバイト順がこの実行形式と合わない場合false
+   */
+  bool Open(const std::string& idxfile);
+
+
+  /**
+   * @brief 一度に読むz方向の範囲
+   * @param [out] cut       範囲の境界（0から，先頭0，末尾kmax）
+   * @param [in]  max_cells 一度に読むセル数の目安
+   * @note 圧縮ファイルは書き出しランクの境界に揃えて，各ランクの符号列を一度だけ展開する
+   */
+  void GetSlabs(std::vector<int>& cut, const size_t max_cells) const;
+
+
+  /**
+   * @brief z方向の範囲を読み込む
+   * @param [in]  k0 開始位置（0から）
+   * @param [in]  nk 層数
+   * @param [out] d  データ（nijk，倍精度に変換）
+   */
+  bool ReadSlab(const int k0, const int nk, double* d) const;
+
+
+  const std::string& GetName() const { return m_name; }
+
+  unsigned GetStep() const { return m_step; }
+
+  double GetTime() const { return m_time; }
+
+  const int* GetGlobalSize() const { return m_gsize; }
+
+  int GetNumComponent() const { return m_ncomp; }
+
+  bool IsDouble() const { return ( m_dsize == 8 ); }
+
+  const double* GetOrigin() const { return m_org; }
+
+  const double* GetPitch() const { return m_pit; }
+
+  double GetTolerance() const { return m_tol; }
+
+  /** 圧縮モード名 */
+  const char* GetCompression() const;
+
+};
+
+#endif // _FileIO_MPIO_H_
@@ -42,6 +42,7 @@
 
 
 #include "FileIO_sph.h"
+#include "FileIO_mpio.h"
 //#include "omp.h"
 
 #include "cdm_DFI.h"
@@ -151,6 +152,7 @@ public:
   int out_format;//combine sph or output plot3d
   int ndfi;//number of dfi file list
   vector<string> dfi_name;
+  vector<string> mpio_name; //共有ファイルのインデクス（*.mpio.idx）
   
   // PLOT3Dfunctions_20131005 FileIO_PLOT3D_READ  FP3DR; ///< PLOT3D READクラス
   // PLOT3Dfunctions_20131005 FileIO_PLOT3D_WRITE FP3DW; ///< PLOT3D WRITEクラス
@@ -520,6 +522,12 @@ public:
    */
   void output_sph();
   
+  
+  /**
+   * @brief 共有ファイル（*.mpio，圧縮を含む）からsphファイルへの変換
+   */
+  void output_mpio();
+  
 
   /**
    * @brief sphファイルのheaderの書き込み（倍精度）